@@ -13,6 +13,7 @@
 #include "BST.h"
 #include "ElementAlreadyExistsInBSTException.h"
 #include "ElementDoesNotExistInBSTException.h"
+#include <algorithm>
 
 
 // Default constructor
@@ -35,12 +36,15 @@ BST<ElementType>::BST(ElementType& element) {
 template <class ElementType>
 BST<ElementType>::BST(const BST<ElementType>& aBST) {
 
+	root = copyR(aBST.root);
+	elementCount = aBST.elementCount;
 }
 
 // Destructor
 template <class ElementType>
 BST<ElementType>::~BST() {
 
+	destroyR(root);
 }
 
 
@@ -58,21 +62,42 @@ template <class ElementType>
 void BST<ElementType>::insert(const ElementType& newElement)
 throw(ElementAlreadyExistsInBSTException) {
 
-	BSTNode<ElementType>* newNode;
-
-	newNode = new BSTNode<ElementType>(newElement);
-
-
 	if (!root) {
-		root = newNode;
+		root = new BSTNode<ElementType>(newElement);
 		elementCount++;
 	}
 	else
-		insertR(newNode->element, root);
-	
-	
+		insertR(newElement, root);
+}
 
-//	delete newNode;
+// Time efficiency: O(log2 n)
+template <class ElementType>
+void BST<ElementType>::remove(const ElementType& targetElement)
+throw(ElementDoesNotExistInBSTException) {
+
+	root = removeR(targetElement, root);
+}
+
+// Time efficiency: O(k log2 n) for a batch of k changes
+template <class ElementType>
+void BST<ElementType>::applyChanges(vector< BSTChange<ElementType> >& changes,
+	vector< BSTChange<ElementType> >& rejected) {
+
+	// Sort once; stable so that the last change to an element stays last
+	stable_sort(changes.begin(), changes.end());
+
+	// Keep only the last change to each element
+	size_t kept = 0;
+	for (size_t i = 0; i < changes.size(); i++) {
+		if (kept > 0 && changes[kept - 1].element == changes[i].element)
+			changes[kept - 1] = changes[i];
+		else
+			changes[kept++] = changes[i];
+	}
+	changes.resize(kept);
+
+	if (!changes.empty())
+		root = applyChangesR(root, &changes[0], &changes[0] + changes.size(), rejected);
 }
 
 // Time efficiency: O(log2 n)
@@ -80,28 +105,14 @@ template <class ElementType>
 ElementType& BST<ElementType>::retrieve(const ElementType& targetElement)
 const throw(ElementDoesNotExistInBSTException) {
 
-//	ElementType* foundElement;
-
-	if (root->element == targetElement) {
-		return root->element;
-	}
-	else {
-		if (root->element < targetElement) {
-			return retrieveR(targetElement, root->right);
-		}
-		else {
-			return retrieveR(targetElement, root->left);
-		}
-	}
+	return retrieveR(targetElement, root);
 }
 
 // Time efficiency: O(n)
 template <class ElementType>
 void BST<ElementType>::traverseInOrder(void visit(ElementType&)) const {
 	
-	traverseInOrderR(visit, root->left);
-	visit(root->element);
-	traverseInOrderR(visit, root->right);
+	traverseInOrderR(visit, root);
 }
 
 
@@ -111,13 +122,8 @@ template <class ElementType>
 bool BST<ElementType>::insertR(const ElementType& element,
 	BSTNode<ElementType>* current) throw(ElementAlreadyExistsInBSTException) {
 
-	BST<ElementType>* newSubTree;
-	ElementType toInsert;
 	bool isInserted = false;
 
-	toInsert = element;
-	newSubTree = new BST<ElementType>(toInsert);
-
 	if (current->element == element)
 		throw ElementAlreadyExistsInBSTException("Element already exists");
 
@@ -126,7 +132,7 @@ bool BST<ElementType>::insertR(const ElementType& element,
 			isInserted = insertR(element, current->right);
 		}
 		else {
-			current->right = newSubTree->root;
+			current->right = new BSTNode<ElementType>(element);
 			elementCount++;
 			isInserted = true;
 		}
@@ -136,7 +142,7 @@ bool BST<ElementType>::insertR(const ElementType& element,
 			isInserted = insertR(element, current->left);
 		}
 		else {
-			current->left = newSubTree->root;
+			current->left = new BSTNode<ElementType>(element);
 			elementCount++;
 			isInserted = true;
 		}
@@ -154,18 +160,14 @@ ElementType& BST<ElementType>::retrieveR(const ElementType& targetElement,
 		throw ElementDoesNotExistInBSTException("Element does not exist");
 
 	if (current->element == targetElement) {
-		cout << endl << "found element" << endl;
 		return current->element;
 	}
 	else {
 		if (current->element < targetElement) {
-			cout << endl << "searching right subtree" << endl;
 			return retrieveR(targetElement, current->right);
 		}
 		else {
-			cout << endl << "searching left subtree" << endl;
 			return retrieveR(targetElement, current->left);
-			cout << endl << "recursed back up from left subtree" << endl;
 		}
 	}
 }
@@ -183,4 +185,142 @@ void BST<ElementType>::traverseInOrderR(void visit(ElementType&),
 		if(current->hasRight())
 			traverseInOrderR(visit, current->right);
 	}
-}
\ No newline at end of file
+}
+
+template <class ElementType>
+BSTNode<ElementType>* BST<ElementType>::removeR(const ElementType& targetElement,
+	BSTNode<ElementType>* current) throw(ElementDoesNotExistInBSTException) {
+
+	if (!current)
+		throw ElementDoesNotExistInBSTException("Element does not exist");
+
+	if (current->element == targetElement)
+		return removeNode(current);
+
+	if (current->element < targetElement)
+		current->right = removeR(targetElement, current->right);
+	else
+		current->left = removeR(targetElement, current->left);
+
+	return current;
+}
+
+// Removes "node" from the tree and returns the root of the subtree that
+// takes its place
+template <class ElementType>
+BSTNode<ElementType>* BST<ElementType>::removeNode(BSTNode<ElementType>* node) {
+
+	BSTNode<ElementType>* replacement;
+
+	if (!node->hasLeft()) {
+		replacement = node->right;
+		delete node;
+	}
+	else if (!node->hasRight()) {
+		replacement = node->left;
+		delete node;
+	}
+	else {
+		// Two children: unlink the in-order successor (leftmost node of the
+		// right subtree) and move its element up into "node"
+		BSTNode<ElementType>* parent = node;
+		BSTNode<ElementType>* successor = node->right;
+
+		while (successor->hasLeft()) {
+			parent = successor;
+			successor = successor->left;
+		}
+
+		if (parent == node)
+			parent->right = successor->right;
+		else
+			parent->left = successor->right;
+
+		node->element = successor->element;
+		delete successor;
+		replacement = node;
+	}
+
+	elementCount--;
+	return replacement;
+}
+
+// Applies the sorted changes [first, last) to the subtree rooted at "current"
+// and returns the root of the resulting subtree. The range is split around
+// each node visited, so only the search paths of the changed elements are walked.
+template <class ElementType>
+BSTNode<ElementType>* BST<ElementType>::applyChangesR(BSTNode<ElementType>* current,
+	BSTChange<ElementType>* first, BSTChange<ElementType>* last,
+	vector< BSTChange<ElementType> >& rejected) {
+
+	if (first == last)
+		return current;
+
+	// Empty subtree: adds become a balanced subtree of new nodes, anything else is rejected
+	if (!current) {
+		vector< BSTNode<ElementType>* > added;
+
+		for (BSTChange<ElementType>* change = first; change != last; change++) {
+			if (change->type == ADD_ELEMENT)
+				added.push_back(new BSTNode<ElementType>(change->element));
+			else
+				rejected.push_back(*change);
+		}
+		elementCount += added.size();
+
+		return added.empty() ? NULL : buildR(&added[0], &added[0] + added.size());
+	}
+
+	// Split the range into changes less than, equal to and greater than this node
+	BSTChange<ElementType> key;
+	key.element = current->element;
+	BSTChange<ElementType>* lower = lower_bound(first, last, key);
+	BSTChange<ElementType>* upper = upper_bound(lower, last, key);
+
+	current->left = applyChangesR(current->left, first, lower, rejected);
+	current->right = applyChangesR(current->right, upper, last, rejected);
+
+	if (lower != upper) {
+		if (lower->type == ADD_ELEMENT)
+			rejected.push_back(*lower);
+		else if (lower->type == UPDATE_ELEMENT)
+			current->element = lower->element;
+		else
+			current = removeNode(current);
+	}
+
+	return current;
+}
+
+// Links the sorted nodes [first, last) into a balanced subtree and returns its root
+template <class ElementType>
+BSTNode<ElementType>* BST<ElementType>::buildR(BSTNode<ElementType>** first, BSTNode<ElementType>** last) {
+
+	if (first == last)
+		return NULL;
+
+	BSTNode<ElementType>** middle = first + (last - first) / 2;
+	(*middle)->left = buildR(first, middle);
+	(*middle)->right = buildR(middle + 1, last);
+
+	return *middle;
+}
+
+template <class ElementType>
+BSTNode<ElementType>* BST<ElementType>::copyR(const BSTNode<ElementType>* current) {
+
+	if (!current)
+		return NULL;
+
+	return new BSTNode<ElementType>(current->element, copyR(current->left), copyR(current->right));
+}
+
+template <class ElementType>
+void BST<ElementType>::destroyR(BSTNode<ElementType>* current) {
+
+	if (current) {
+		destroyR(current->left);
+		destroyR(current->right);
+		delete current;
+	}
+}
@@ -13,9 +13,11 @@
  #pragma once
 
 #include "BSTNode.h"
+#include "BSTChange.h"
 #include "ElementAlreadyExistsInBSTException.h"
 #include "ElementDoesNotExistInBSTException.h"
 #include <iostream>
+#include <vector>
 
 
 template <class ElementType>
@@ -29,6 +31,13 @@ private:
     bool insertR(const ElementType& element, BSTNode<ElementType>* current) throw(ElementAlreadyExistsInBSTException);
     ElementType& retrieveR(const ElementType& targetElement, BSTNode<ElementType>* current) const throw(ElementDoesNotExistInBSTException);
 	void traverseInOrderR(void visit(ElementType&), BSTNode<ElementType>* current) const;
+    BSTNode<ElementType>* removeR(const ElementType& targetElement, BSTNode<ElementType>* current) throw(ElementDoesNotExistInBSTException);
+    BSTNode<ElementType>* removeNode(BSTNode<ElementType>* node);
+    BSTNode<ElementType>* applyChangesR(BSTNode<ElementType>* current, BSTChange<ElementType>* first,
+        BSTChange<ElementType>* last, vector< BSTChange<ElementType> >& rejected);
+    BSTNode<ElementType>* buildR(BSTNode<ElementType>** first, BSTNode<ElementType>** last);
+    BSTNode<ElementType>* copyR(const BSTNode<ElementType>* current);
+    void destroyR(BSTNode<ElementType>* current);
          
 
 public:
@@ -46,6 +55,16 @@ public:
 	// Time efficiency: O(log2 n)
 	void insert(const ElementType& newElement) throw(ElementAlreadyExistsInBSTException);	
 
+	// Time efficiency: O(log2 n)
+	void remove(const ElementType& targetElement) throw(ElementDoesNotExistInBSTException);
+
+	// Description: Applies a batch of changes in one pass down the tree. The
+	//              batch is sorted once; when it holds several changes to the
+	//              same element, only the last one is applied. Changes that
+	//              cannot be applied are appended to "rejected".
+	// Time efficiency: O(k log2 n) for a batch of k changes
+	void applyChanges(vector< BSTChange<ElementType> >& changes, vector< BSTChange<ElementType> >& rejected);
+
 	// Time efficiency: O(log2 n)
 	ElementType& retrieve(const ElementType& targetElement) const throw(ElementDoesNotExistInBSTException);
 
@@ -0,0 +1,29 @@
+/*
+ * BSTChange.h
+ * 
+ * Description: Models one change in a batch of changes applied to a
+ *              binary search tree (BST) with BST::applyChanges.
+ * 
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#pragma once
+
+enum BSTChangeType {
+	ADD_ELEMENT,		// Insert element; rejected if it already exists
+	UPDATE_ELEMENT,		// Replace the matching element; rejected if it does not exist
+	REMOVE_ELEMENT		// Remove the matching element; rejected if it does not exist
+};
+
+template <class ElementType>
+struct BSTChange {
+
+	BSTChangeType type;
+	ElementType element;
+
+	// Orders changes by element, so a batch can be sorted once before it is applied
+	bool operator<(const BSTChange<ElementType>& rhs) const {
+		return element < rhs.element;
+	}
+};
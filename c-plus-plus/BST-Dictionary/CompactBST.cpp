@@ -0,0 +1,158 @@
+/*
+ * CompactBST.cpp
+ *
+ * Description: Data collection Binary Search Tree of WordPairs.
+ *              Array-based implementation: nodes are stored contiguously in
+ *              a vector and linked by 32-bit indices instead of pointers, and
+ *              word text lives in two shared character arenas.
+ *
+ * Class invariant: It is always a BST.
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#include "CompactBST.h"
+#include "KeyCompare.h"
+
+
+// Constructor
+CompactBST::CompactBST() {
+
+	root = NO_NODE;
+}
+
+
+// BST operations:
+
+// Time efficiency: O(1)
+int CompactBST::getElementCount() const {
+
+	return nodes.size();
+}
+
+// Time efficiency: O(1)
+size_t CompactBST::getMemoryUsage() const {
+
+	return sizeof(CompactBST) + nodes.capacity() * sizeof(CompactBSTNode)
+		+ englishArena.capacity() + translationArena.capacity();
+}
+
+// Time efficiency: O(log2 n)
+void CompactBST::insert(const WordPair& newElement)
+throw(ElementAlreadyExistsInBSTException) {
+
+	string english = newElement.getEnglish();
+	string translation = newElement.getTranslation();
+	unsigned long long prefix = makePrefix(english.data(), english.length());
+	unsigned int* link = &root;
+
+	// Walk down to the empty child link where the new node belongs
+	while (*link != NO_NODE) {
+		int comparison = compareTo(nodes[*link], prefix, english);
+
+		if (comparison == 0)
+			throw ElementAlreadyExistsInBSTException("Element already exists");
+
+		if (comparison < 0)
+			link = &nodes[*link].right;
+		else
+			link = &nodes[*link].left;
+	}
+
+	CompactBSTNode newNode;
+	newNode.prefix = prefix;
+	newNode.left = NO_NODE;
+	newNode.right = NO_NODE;
+	newNode.englishOffset = englishArena.length();
+	newNode.englishLength = english.length();
+	newNode.translationOffset = translationArena.length();
+	newNode.translationLength = translation.length();
+
+	englishArena += english;
+	translationArena += translation;
+
+	// Link before push_back, which may reallocate the vector "link" points into
+	*link = nodes.size();
+	nodes.push_back(newNode);
+}
+
+// Time efficiency: O(log2 n)
+WordPair CompactBST::retrieve(const WordPair& targetElement)
+const throw(ElementDoesNotExistInBSTException) {
+
+	string english = targetElement.getEnglish();
+	unsigned long long prefix = makePrefix(english.data(), english.length());
+	unsigned int current = root;
+
+	while (current != NO_NODE) {
+		int comparison = compareTo(nodes[current], prefix, english);
+
+		if (comparison == 0)
+			return elementAt(current);
+
+		if (comparison < 0)
+			current = nodes[current].right;
+		else
+			current = nodes[current].left;
+	}
+
+	throw ElementDoesNotExistInBSTException("Element does not exist");
+}
+
+// Time efficiency: O(n)
+void CompactBST::traverseInOrder(void visit(WordPair&)) const {
+
+	traverseInOrderR(visit, root);
+}
+
+
+// Private methods
+
+// Packs the first PREFIX_LENGTH bytes of word big-endian, padding with zeros.
+// A zero pad sorts before every byte, so prefixes that differ as integers
+// order their words exactly as string::compare would.
+unsigned long long CompactBST::makePrefix(const char* word, size_t length) {
+
+	unsigned long long prefix = 0;
+
+	for (unsigned int i = 0; i < PREFIX_LENGTH; i++) {
+		prefix <<= 8;
+		if (i < length)
+			prefix |= (unsigned char)word[i];
+	}
+
+	return prefix;
+}
+
+// Returns a negative value, zero or a positive value if the node's English
+// word is less than, equal to or greater than "word" ("prefix" is its prefix)
+int CompactBST::compareTo(const CompactBSTNode& node, unsigned long long prefix, const string& word) const {
+
+	if (node.prefix != prefix)
+		return node.prefix < prefix ? -1 : 1;
+
+	// Equal prefixes: compare the whole words from the arena
+	return compareKeys(englishArena.data() + node.englishOffset, node.englishLength,
+		word.data(), word.length());
+}
+
+WordPair CompactBST::elementAt(unsigned int index) const {
+
+	const CompactBSTNode& node = nodes[index];
+
+	return WordPair(englishArena.substr(node.englishOffset, node.englishLength),
+		translationArena.substr(node.translationOffset, node.translationLength));
+}
+
+void CompactBST::traverseInOrderR(void visit(WordPair&), unsigned int current) const {
+
+	if (current != NO_NODE) {
+		traverseInOrderR(visit, nodes[current].left);
+
+		WordPair element = elementAt(current);
+		visit(element);
+
+		traverseInOrderR(visit, nodes[current].right);
+	}
+}
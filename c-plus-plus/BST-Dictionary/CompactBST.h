@@ -0,0 +1,85 @@
+/*
+ * CompactBST.h
+ *
+ * Description: Data collection Binary Search Tree of WordPairs.
+ *              Array-based implementation: nodes are stored contiguously in
+ *              a vector and linked by 32-bit indices instead of pointers, and
+ *              word text lives in two shared character arenas.
+ *
+ *              Each node carries the first PREFIX_LENGTH bytes of its English
+ *              word packed big-endian into an integer, so that comparing two
+ *              prefixes as integers orders them like the words themselves.
+ *              Most comparisons during a search are settled by the prefix
+ *              alone, without reading the arena.
+ *
+ * Class invariant: It is always a BST.
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "WordPair.h"
+#include "ElementAlreadyExistsInBSTException.h"
+#include "ElementDoesNotExistInBSTException.h"
+
+using namespace std;
+
+
+// Models a node of a CompactBST (32 bytes)
+struct CompactBSTNode {
+	unsigned long long prefix;		// Leading key bytes, big-endian, zero padded
+	unsigned int left;				// Index of left child, or CompactBST::NO_NODE
+	unsigned int right;				// Index of right child, or CompactBST::NO_NODE
+	unsigned int englishOffset;		// Position of English word in english arena
+	unsigned int englishLength;		// Length of English word
+	unsigned int translationOffset;	// Position of translation in translation arena
+	unsigned int translationLength;	// Length of translation
+};
+
+
+class CompactBST {
+
+public:
+	static const unsigned int NO_NODE = 0xFFFFFFFFu;		// Index of a missing child
+	static const unsigned int PREFIX_LENGTH = sizeof(unsigned long long);
+
+private:
+	vector<CompactBSTNode> nodes;	// All nodes; nodes[root] is the root
+	string englishArena;			// Concatenated English words
+	string translationArena;		// Concatenated translations
+	unsigned int root;
+
+	// Utility methods
+	static unsigned long long makePrefix(const char* word, size_t length);
+	int compareTo(const CompactBSTNode& node, unsigned long long prefix, const string& word) const;
+	WordPair elementAt(unsigned int index) const;
+	void traverseInOrderR(void visit(WordPair&), unsigned int current) const;
+
+public:
+	// Constructor
+	CompactBST();
+
+	// BST operations:
+
+	// Time efficiency: O(1)
+	int getElementCount() const;
+
+	// Description: Returns the number of bytes of memory held by this tree.
+	// Time efficiency: O(1)
+	size_t getMemoryUsage() const;
+
+	// Time efficiency: O(log2 n)
+	void insert(const WordPair& newElement) throw(ElementAlreadyExistsInBSTException);
+
+	// Description: Returns (a copy of) the element whose English word matches targetElement's.
+	// Time efficiency: O(log2 n)
+	WordPair retrieve(const WordPair& targetElement) const throw(ElementDoesNotExistInBSTException);
+
+	// Time efficiency: O(n)
+	void traverseInOrder(void visit(WordPair&)) const;
+
+}; // end CompactBST
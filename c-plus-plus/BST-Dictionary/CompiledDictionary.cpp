@@ -0,0 +1,50 @@
+/*
+ * CompiledDictionary.cpp
+ *
+ * Description: Read-only translation dictionary compiled into the executable.
+ *              The tables are generated at build time by dictGen from
+ *              'dataFile.txt', so no file is parsed and no tree is built at
+ *              start up. A lookup costs one probe into the seed table and one
+ *              probe into the entry table (see PerfectHash.h).
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#include <cstring>
+#include "CompiledDictionary.h"
+#include "PerfectHash.h"
+#include "CompiledDictionaryData.h"
+
+
+// Time efficiency: O(1)
+int CompiledDictionary::getElementCount() {
+
+	return COMPILED_ENTRY_COUNT;
+}
+
+// Time efficiency: O(1)
+WordPair CompiledDictionary::retrieve(const WordPair& targetElement)
+throw(ElementDoesNotExistInBSTException) {
+
+	string english = targetElement.getEnglish();
+
+	if (COMPILED_ENTRY_COUNT == 0)
+		throw ElementDoesNotExistInBSTException("Element does not exist");
+
+	// First probe: displacement seed of the word's bucket
+	unsigned int bucket = perfectHash(english.data(), english.length(), 0) % COMPILED_BUCKET_COUNT;
+	unsigned int seed = compiledSeeds[bucket];
+
+	// Second probe: the only slot the word can occupy
+	const CompiledEntry& entry =
+		compiledEntries[perfectHash(english.data(), english.length(), seed) % COMPILED_ENTRY_COUNT];
+
+	// A perfect hash maps every word to some slot, so the slot's word must still be compared
+	if (seed == 0 || entry.englishLength != english.length()
+		|| memcmp(entry.english, english.data(), english.length()) != 0)
+		throw ElementDoesNotExistInBSTException("Element does not exist");
+
+	return WordPair(string(entry.english, entry.englishLength),
+		string(entry.translation, entry.translationLength));
+}
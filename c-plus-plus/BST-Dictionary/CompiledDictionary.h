@@ -0,0 +1,40 @@
+/*
+ * CompiledDictionary.h
+ *
+ * Description: Read-only translation dictionary compiled into the executable.
+ *              The tables are generated at build time by dictGen from
+ *              'dataFile.txt', so no file is parsed and no tree is built at
+ *              start up. A lookup costs one probe into the seed table and one
+ *              probe into the entry table (see PerfectHash.h).
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#pragma once
+
+#include "WordPair.h"
+#include "ElementDoesNotExistInBSTException.h"
+
+
+// One dictionary entry as laid out in the generated tables
+struct CompiledEntry {
+	const char* english;
+	unsigned int englishLength;
+	const char* translation;
+	unsigned int translationLength;
+};
+
+
+class CompiledDictionary {
+
+public:
+	// Time efficiency: O(1)
+	static int getElementCount();
+
+	// Description: Returns the WordPair whose English word matches that of targetElement.
+	// Exceptions: Throws ElementDoesNotExistInBSTException if the word is not in the dictionary.
+	// Time efficiency: O(1)
+	static WordPair retrieve(const WordPair& targetElement) throw(ElementDoesNotExistInBSTException);
+
+}; // end CompiledDictionary
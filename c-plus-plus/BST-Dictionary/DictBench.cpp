@@ -0,0 +1,199 @@
+/*
+ * DictBench.cpp
+ *
+ * Description: Benchmarks for the translation dictionary data collections.
+ *              Builds each dictionary from the same shuffled set of random
+ *              words and reports memory use per entry and lookup time, then
+ *              times the key comparison kernels on long shared-prefix keys.
+ *
+ *              Usage: dictBench [numberOfWords]
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "BST.h"
+#include "CompactBST.h"
+#include "WordPair.h"
+#include "KeyCompare.h"
+
+using namespace std;
+
+
+// Number of lookups timed per dictionary
+const int LOOKUPS = 1000000;
+
+
+// Heap bytes held by a string beyond the string object itself
+size_t heapBytes(const string& s) {
+
+	// libstdc++ keeps strings of up to 15 characters inside the object
+	return s.capacity() > 15 ? s.capacity() + 1 : 0;
+}
+
+// Returns a random lowercase word of 4 to 12 letters
+string randomWord(mt19937& generator) {
+
+	uniform_int_distribution<int> length(4, 12);
+	uniform_int_distribution<int> letter('a', 'z');
+	string word;
+
+	for (int i = length(generator); i > 0; i--)
+		word += (char)letter(generator);
+
+	return word;
+}
+
+// Runs "lookup" on LOOKUPS random keys and returns nanoseconds per lookup
+template <class Lookup>
+double timeLookups(const vector<WordPair>& keys, const vector<int>& order, Lookup lookup) {
+
+	size_t checksum = 0;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	for (int i = 0; i < LOOKUPS; i++)
+		checksum += lookup(keys[order[i]]);
+
+	chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+
+	// Keep the lookups from being optimized away
+	if (checksum == 0)
+		cout << "";
+
+	return elapsed.count() / LOOKUPS;
+}
+
+void printRow(const string& name, double bytesPerEntry, double nsPerLookup) {
+
+	cout << left << setw(22) << name << right << fixed << setprecision(1)
+		<< setw(16) << bytesPerEntry << setw(14) << nsPerLookup << endl;
+}
+
+// Number of comparisons timed per key length and kernel
+const int COMPARISONS = 2000000;
+
+// Times COMPARISONS calls of "compare" on keys that differ only in their last
+// byte and returns nanoseconds per comparison
+template <class Compare>
+double timeComparisons(const vector<string>& keys, Compare compare) {
+
+	long long checksum = 0;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	for (int i = 0; i < COMPARISONS; i++) {
+		const string& a = keys[i & 7];
+		const string& b = keys[(i + 1) & 7];
+		checksum += compare(a, b);
+	}
+
+	chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+
+	if (checksum == 1)
+		cout << "";
+
+	return elapsed.count() / COMPARISONS;
+}
+
+// Compares long keys with a shared prefix using each comparison kernel
+void benchmarkKeyComparison() {
+
+	size_t lengths[] = { 8, 16, 64, 256, 1024 };
+
+	cout << endl << "Key comparison, keys differing in the last byte (ns/comparison)" << endl;
+	cout << "Kernel selected at run time: " << keyCompareKernelName() << endl;
+	cout << left << setw(10) << "Length" << right << setw(16) << "string::compare"
+		<< setw(10) << "scalar";
+#if defined(__x86_64__) || defined(__i386__)
+	cout << setw(10) << "SSE2" << setw(10) << "AVX2";
+#endif
+	cout << setw(14) << "compareKeys" << endl;
+
+	for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+		vector<string> keys;
+		for (int k = 0; k < 8; k++)
+			keys.push_back(string(lengths[l] - 1, 'p') + (char)('a' + k));
+
+		cout << left << setw(10) << lengths[l] << right << fixed << setprecision(2);
+		cout << setw(16) << timeComparisons(keys, [](const string& a, const string& b) {
+			return a.compare(b);
+		});
+		cout << setw(10) << timeComparisons(keys, [](const string& a, const string& b) {
+			return (long long)mismatchScalar(a.data(), b.data(), a.length());
+		});
+#if defined(__x86_64__) || defined(__i386__)
+		cout << setw(10) << timeComparisons(keys, [](const string& a, const string& b) {
+			return (long long)mismatchSSE2(a.data(), b.data(), a.length());
+		});
+		if (keyCompareHasAVX2())
+			cout << setw(10) << timeComparisons(keys, [](const string& a, const string& b) {
+				return (long long)mismatchAVX2(a.data(), b.data(), a.length());
+			});
+		else
+			cout << setw(10) << "-";
+#endif
+		cout << setw(14) << timeComparisons(keys, [](const string& a, const string& b) {
+			return compareKeys(a.data(), a.length(), b.data(), b.length());
+		}) << endl;
+	}
+}
+
+
+int main(int argc, char *argv[]) {
+
+	int wordCount = (argc > 1) ? atoi(argv[1]) : 200000;
+	mt19937 generator(225);
+	vector<WordPair> words;
+	vector<int> order(LOOKUPS);
+
+	// Distinct random words with translations, in random order
+	vector<string> english;
+	for (int i = 0; i < wordCount; i++)
+		english.push_back(randomWord(generator));
+	sort(english.begin(), english.end());
+	english.erase(unique(english.begin(), english.end()), english.end());
+	shuffle(english.begin(), english.end(), generator);
+	for (size_t i = 0; i < english.size(); i++)
+		words.push_back(WordPair(english[i], randomWord(generator)));
+
+	uniform_int_distribution<int> pick(0, words.size() - 1);
+	for (int i = 0; i < LOOKUPS; i++)
+		order[i] = pick(generator);
+
+	cout << "Dictionary of " << words.size() << " words, " << LOOKUPS << " lookups" << endl;
+	cout << left << setw(22) << "Data collection" << right << setw(16) << "Bytes/entry"
+		<< setw(14) << "ns/lookup" << endl;
+
+	// Link-based BST: one node allocation per entry plus the strings' heap payloads
+	BST<WordPair> tree;
+	size_t treeBytes = 0;
+	for (size_t i = 0; i < words.size(); i++) {
+		tree.insert(words[i]);
+		treeBytes += sizeof(BSTNode<WordPair>) + heapBytes(words[i].getEnglish())
+			+ heapBytes(words[i].getTranslation());
+	}
+	double treeTime = timeLookups(words, order, [&tree](const WordPair& key) {
+		return tree.retrieve(key).getTranslation().length();
+	});
+	printRow("BST<WordPair>", (double)treeBytes / words.size(), treeTime);
+
+	// Array-based BST with 32-bit links and inline key prefixes
+	CompactBST compact;
+	for (size_t i = 0; i < words.size(); i++)
+		compact.insert(words[i]);
+	double compactTime = timeLookups(words, order, [&compact](const WordPair& key) {
+		return compact.retrieve(key).getTranslation().length();
+	});
+	printRow("CompactBST", (double)compact.getMemoryUsage() / words.size(), compactTime);
+
+	benchmarkKeyComparison();
+
+	return 0;
+}
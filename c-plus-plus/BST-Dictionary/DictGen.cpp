@@ -0,0 +1,184 @@
+/*
+ * DictGen.cpp
+ *
+ * Description: Dictionary generator. Reads a dictionary file in the same
+ *              "english:translation" format as 'dataFile.txt' and writes a
+ *              C++ header of constexpr tables holding a minimal perfect hash
+ *              of the English words (see PerfectHash.h).
+ *
+ *              Usage: dictGen dataFile.txt > CompiledDictionaryData.h
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <cstdio>
+#include "PerfectHash.h"
+
+using namespace std;
+
+
+// Entries per bucket on average; larger values give a smaller seed table
+// but take longer to find displacement seeds for
+const unsigned int KEYS_PER_BUCKET = 2;
+
+// Give up on a bucket after this many displacement seeds
+const unsigned int MAX_SEED = 1000000;
+
+
+// Description: Writes "text" as a C++ string literal. Bytes outside printable
+//              ASCII are written as 3-digit octal escapes, which (unlike hex
+//              escapes) cannot swallow the character that follows them.
+void writeLiteral(ostream& out, const string& text) {
+
+	char escape[8];
+
+	out << '"';
+	for (size_t i = 0; i < text.length(); i++) {
+		unsigned char c = text[i];
+		if (c == '"' || c == '\\' || c == '?')
+			out << '\\' << c;
+		else if (c < 0x20 || c >= 0x7F) {
+			snprintf(escape, sizeof(escape), "\\%03o", c);
+			out << escape;
+		}
+		else
+			out << c;
+	}
+	out << '"';
+}
+
+
+// Description: Sorts bucket indices so that larger buckets are placed first.
+struct LargerBucketFirst {
+
+	const vector< vector<unsigned int> >* buckets;
+
+	bool operator()(unsigned int lhs, unsigned int rhs) const {
+		if ((*buckets)[lhs].size() != (*buckets)[rhs].size())
+			return (*buckets)[lhs].size() > (*buckets)[rhs].size();
+		return lhs < rhs;
+	}
+};
+
+
+int main(int argc, char *argv[]) {
+
+	vector<string> english;			// English words, in file order
+	vector<string> translation;		// Translation of each English word
+	set<string> seen;				// English words read so far
+	string aLine = "";
+	string delimiter = ":";
+	size_t pos = 0;
+
+	if (argc != 2) {
+		cerr << "Usage: " << argv[0] << " dictionaryFile" << endl;
+		return 1;
+	}
+
+	ifstream myfile(argv[1]);
+	if (!myfile.is_open()) {
+		cerr << "Unable to open file " << argv[1] << endl;
+		return 1;
+	}
+
+	// Parse exactly as TApp does; the first occurrence of a word wins
+	while (getline(myfile, aLine)) {
+		pos = aLine.find(delimiter);
+		string englishW = aLine.substr(0, pos);
+		aLine.erase(0, pos + delimiter.length());
+
+		if (!seen.insert(englishW).second) {
+			cerr << "Skipping duplicate word => " << englishW << ":" << aLine << endl;
+			continue;
+		}
+		english.push_back(englishW);
+		translation.push_back(aLine);
+	}
+	myfile.close();
+
+	unsigned int entryCount = english.size();
+	unsigned int bucketCount = entryCount / KEYS_PER_BUCKET + 1;
+
+	// Distribute words into buckets using the seed 0 hash
+	vector< vector<unsigned int> > buckets(bucketCount);
+	for (unsigned int i = 0; i < entryCount; i++)
+		buckets[perfectHash(english[i].data(), english[i].length(), 0) % bucketCount].push_back(i);
+
+	// Place the largest buckets first while the table is still mostly free
+	vector<unsigned int> order(bucketCount);
+	for (unsigned int b = 0; b < bucketCount; b++)
+		order[b] = b;
+	LargerBucketFirst largerFirst = { &buckets };
+	sort(order.begin(), order.end(), largerFirst);
+
+	vector<unsigned int> seeds(bucketCount, 0);
+	vector<int> slotOwner(entryCount, -1);
+	vector<unsigned int> slots;
+
+	for (unsigned int o = 0; o < bucketCount && !buckets[order[o]].empty(); o++) {
+		const vector<unsigned int>& bucket = buckets[order[o]];
+		bool placed = false;
+
+		// Search for a seed that sends every word of the bucket to a distinct free slot
+		for (unsigned int seed = 1; !placed && seed < MAX_SEED; seed++) {
+			slots.clear();
+			placed = true;
+			for (size_t k = 0; placed && k < bucket.size(); k++) {
+				const string& word = english[bucket[k]];
+				unsigned int slot = perfectHash(word.data(), word.length(), seed) % entryCount;
+				if (slotOwner[slot] != -1 || find(slots.begin(), slots.end(), slot) != slots.end())
+					placed = false;
+				else
+					slots.push_back(slot);
+			}
+			if (placed) {
+				seeds[order[o]] = seed;
+				for (size_t k = 0; k < bucket.size(); k++)
+					slotOwner[slots[k]] = bucket[k];
+			}
+		}
+
+		if (!placed) {
+			cerr << "Unable to find a perfect hash seed for bucket " << order[o] << endl;
+			return 1;
+		}
+	}
+
+	// Emit the tables; arrays always have at least one element so that an
+	// empty dictionary still compiles
+	cout << "/*" << endl;
+	cout << " * CompiledDictionaryData.h" << endl;
+	cout << " *" << endl;
+	cout << " * Description: Generated by dictGen from '" << argv[1] << "'. Do not edit." << endl;
+	cout << " */" << endl << endl;
+	cout << "#pragma once" << endl << endl;
+	cout << "const unsigned int COMPILED_ENTRY_COUNT = " << entryCount << ";" << endl;
+	cout << "const unsigned int COMPILED_BUCKET_COUNT = " << bucketCount << ";" << endl << endl;
+
+	cout << "constexpr unsigned int compiledSeeds[" << bucketCount << "] = {";
+	for (unsigned int b = 0; b < bucketCount; b++)
+		cout << (b % 12 == 0 ? "\n\t" : " ") << seeds[b] << ",";
+	cout << endl << "};" << endl << endl;
+
+	cout << "constexpr CompiledEntry compiledEntries[" << max(entryCount, 1u) << "] = {" << endl;
+	for (unsigned int s = 0; s < entryCount; s++) {
+		unsigned int i = slotOwner[s];
+		cout << "\t{ ";
+		writeLiteral(cout, english[i]);
+		cout << ", " << english[i].length() << ", ";
+		writeLiteral(cout, translation[i]);
+		cout << ", " << translation[i].length() << " }," << endl;
+	}
+	if (entryCount == 0)
+		cout << "\t{ \"\", 0, \"\", 0 }," << endl;
+	cout << "};" << endl;
+
+	return 0;
+}
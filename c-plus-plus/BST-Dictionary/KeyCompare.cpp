@@ -0,0 +1,180 @@
+/*
+ * KeyCompare.cpp
+ *
+ * Description: Byte-wise key comparison used by the dictionary comparators.
+ *              Keys are compared a 16-byte (SSE2) or 32-byte (AVX2) block at a
+ *              time to find the first differing byte. The widest kernel the
+ *              processor supports is chosen once, during static
+ *              initialization; other platforms use the scalar kernel.
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#include <cstring>
+#include "KeyCompare.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+
+size_t mismatchScalar(const char* a, const char* b, size_t length) {
+
+	size_t i = 0;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	// Compare 8 bytes at a time; the lowest set bit of the XOR is the first
+	// differing byte on a little-endian machine
+	for (; i + 8 <= length; i += 8) {
+		unsigned long long wordA, wordB;
+		memcpy(&wordA, a + i, 8);
+		memcpy(&wordB, b + i, 8);
+		if (wordA != wordB)
+			return i + __builtin_ctzll(wordA ^ wordB) / 8;
+	}
+#endif
+
+	while (i < length && a[i] == b[i])
+		i++;
+
+	return i;
+}
+
+
+#if defined(__x86_64__) || defined(__i386__)
+
+__attribute__((target("sse2")))
+size_t mismatchSSE2(const char* a, const char* b, size_t length) {
+
+	size_t i = 0;
+
+	// Compare whole 16-byte blocks; a clear bit in the mask marks a differing byte
+	for (; i + 16 <= length; i += 16) {
+		__m128i blockA = _mm_loadu_si128((const __m128i*)(a + i));
+		__m128i blockB = _mm_loadu_si128((const __m128i*)(b + i));
+		unsigned int equal = _mm_movemask_epi8(_mm_cmpeq_epi8(blockA, blockB));
+
+		if (equal != 0xFFFFu)
+			return i + __builtin_ctz(~equal);
+	}
+
+	if (i == length)
+		return length;
+
+	// Never read past the end of either key: finish with the 16-byte block
+	// that ends at "length", which overlaps bytes already known to be equal
+	if (length >= 16) {
+		i = length - 16;
+		__m128i blockA = _mm_loadu_si128((const __m128i*)(a + i));
+		__m128i blockB = _mm_loadu_si128((const __m128i*)(b + i));
+		unsigned int equal = _mm_movemask_epi8(_mm_cmpeq_epi8(blockA, blockB));
+		return equal != 0xFFFFu ? i + __builtin_ctz(~equal) : length;
+	}
+
+	return mismatchScalar(a, b, length);
+}
+
+__attribute__((target("avx2")))
+size_t mismatchAVX2(const char* a, const char* b, size_t length) {
+
+	size_t i = 0;
+
+	// Two blocks per iteration, so long equal runs take one branch per 64 bytes
+	for (; i + 64 <= length; i += 64) {
+		__m256i equalLow = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(a + i)),
+			_mm256_loadu_si256((const __m256i*)(b + i)));
+		__m256i equalHigh = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(a + i + 32)),
+			_mm256_loadu_si256((const __m256i*)(b + i + 32)));
+
+		if ((unsigned int)_mm256_movemask_epi8(_mm256_and_si256(equalLow, equalHigh)) != 0xFFFFFFFFu) {
+			unsigned int equal = _mm256_movemask_epi8(equalLow);
+			if (equal != 0xFFFFFFFFu)
+				return i + __builtin_ctz(~equal);
+			return i + 32 + __builtin_ctz(~(unsigned int)_mm256_movemask_epi8(equalHigh));
+		}
+	}
+
+	for (; i + 32 <= length; i += 32) {
+		__m256i blockA = _mm256_loadu_si256((const __m256i*)(a + i));
+		__m256i blockB = _mm256_loadu_si256((const __m256i*)(b + i));
+		unsigned int equal = _mm256_movemask_epi8(_mm256_cmpeq_epi8(blockA, blockB));
+
+		if (equal != 0xFFFFFFFFu)
+			return i + __builtin_ctz(~equal);
+	}
+
+	if (i == length)
+		return length;
+
+	if (length >= 32) {
+		i = length - 32;
+		__m256i blockA = _mm256_loadu_si256((const __m256i*)(a + i));
+		__m256i blockB = _mm256_loadu_si256((const __m256i*)(b + i));
+		unsigned int equal = _mm256_movemask_epi8(_mm256_cmpeq_epi8(blockA, blockB));
+		return equal != 0xFFFFFFFFu ? i + __builtin_ctz(~equal) : length;
+	}
+
+	return mismatchSSE2(a, b, length);
+}
+
+bool keyCompareHasAVX2() {
+
+	return __builtin_cpu_supports("avx2");
+}
+
+#else
+
+bool keyCompareHasAVX2() {
+
+	return false;
+}
+
+#endif
+
+
+// Picks the kernel for this processor
+static MismatchKernel selectKernel(const char** name) {
+
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	if (keyCompareHasAVX2()) {
+		*name = "AVX2";
+		return mismatchAVX2;
+	}
+	if (__builtin_cpu_supports("sse2")) {
+		*name = "SSE2";
+		return mismatchSSE2;
+	}
+#endif
+	*name = "scalar";
+	return mismatchScalar;
+}
+
+static const char* kernelName = "";
+
+// Chooses the kernel, for a comparison made during static initialization
+// before keyMismatchKernel is set, and compares with it
+static size_t mismatchFirstCall(const char* a, const char* b, size_t length) {
+
+	keyMismatchKernel = selectKernel(&kernelName);
+	return keyMismatchKernel(a, b, length);
+}
+
+// Constant-initialized, so it is never read unset, then set once during
+// static initialization, so comparisons pay no guard to use it
+MismatchKernel keyMismatchKernel = mismatchFirstCall;
+
+static struct KernelSelection {
+	KernelSelection() {
+		keyMismatchKernel = selectKernel(&kernelName);
+	}
+} kernelSelection;
+
+
+const char* keyCompareKernelName() {
+
+	if (keyMismatchKernel == mismatchFirstCall)
+		keyMismatchKernel = selectKernel(&kernelName);
+	return kernelName;
+}
@@ -0,0 +1,71 @@
+/*
+ * KeyCompare.h
+ *
+ * Description: Byte-wise key comparison used by the dictionary comparators.
+ *              Keys are compared a 16-byte (SSE2) or 32-byte (AVX2) block at a
+ *              time to find the first differing byte. The widest kernel the
+ *              processor supports is chosen once, during static
+ *              initialization; other platforms use the scalar kernel.
+ *              compareKeys() is inline. Keys shorter than
+ *              KEY_KERNEL_MINIMUM bytes are compared with memcmp, as
+ *              string::compare does, since a call through the kernel
+ *              pointer costs more than it saves on them.
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+
+// Description: Returns the index of the first byte at which a and b differ,
+//              or length if their first "length" bytes are equal.
+typedef size_t (*MismatchKernel)(const char* a, const char* b, size_t length);
+
+// Kernels, exposed for benchmarking. SSE2 and AVX2 kernels are only
+// available on x86; do not call mismatchAVX2 unless keyCompareHasAVX2().
+size_t mismatchScalar(const char* a, const char* b, size_t length);
+#if defined(__x86_64__) || defined(__i386__)
+size_t mismatchSSE2(const char* a, const char* b, size_t length);
+size_t mismatchAVX2(const char* a, const char* b, size_t length);
+#endif
+
+// Description: Returns true if the processor supports the AVX2 kernel.
+bool keyCompareHasAVX2();
+
+// Description: Returns the name of the kernel chosen for this processor.
+const char* keyCompareKernelName();
+
+// The kernel chosen for this processor. Until static initialization
+// chooses it, it points at a kernel that chooses it on its first call.
+extern MismatchKernel keyMismatchKernel;
+
+// Shortest common length compared with the kernel rather than memcmp
+const size_t KEY_KERNEL_MINIMUM = 64;
+
+// Description: Compares two keys like string::compare: returns a negative
+//              value, zero or a positive value if a is less than, equal to
+//              or greater than b. Bytes compare as unsigned.
+// Time Efficiency: O(min(aLength, bLength))
+inline int compareKeys(const char* a, size_t aLength, const char* b, size_t bLength) {
+
+	size_t length = aLength < bLength ? aLength : bLength;
+
+	if (length < KEY_KERNEL_MINIMUM) {
+		int comparison = memcmp(a, b, length);
+		if (comparison != 0)
+			return comparison;
+	}
+	else {
+		size_t i = keyMismatchKernel(a, b, length);
+		if (i < length)
+			return (int)(unsigned char)a[i] - (int)(unsigned char)b[i];
+	}
+
+	if (aLength != bLength)
+		return aLength < bLength ? -1 : 1;
+	return 0;
+}
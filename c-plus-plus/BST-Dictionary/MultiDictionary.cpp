@@ -0,0 +1,160 @@
+/*
+ * MultiDictionary.cpp
+ *
+ * Description: Translation dictionary from English into several languages.
+ *              The English words are stored once, sorted, in a single
+ *              character arena and searched by binary search. Each language
+ *              is a column: its translations are stored contiguously in a
+ *              separate arena, in the same order as the English words.
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#include <algorithm>
+#include <cctype>
+#include "MultiDictionary.h"
+#include "KeyCompare.h"
+
+
+// Orders staged row indices by English word, then by staging order
+struct StagedRowLess {
+
+	const vector<string>* english;
+
+	bool operator()(unsigned int lhs, unsigned int rhs) const {
+		int comparison = compareKeys((*english)[lhs].data(), (*english)[lhs].length(),
+			(*english)[rhs].data(), (*english)[rhs].length());
+		return comparison < 0 || (comparison == 0 && lhs < rhs);
+	}
+};
+
+
+// Constructor
+MultiDictionary::MultiDictionary(const vector<string>& languageNames) {
+
+	columns.resize(languageNames.size());
+	for (size_t c = 0; c < languageNames.size(); c++) {
+		columns[c].name = languageNames[c];
+		columns[c].offsets.push_back(0);
+	}
+	englishOffsets.push_back(0);
+}
+
+// Time efficiency: O(1)
+int MultiDictionary::getElementCount() const {
+
+	return englishOffsets.size() - 1;
+}
+
+// Time efficiency: O(1)
+int MultiDictionary::getLanguageCount() const {
+
+	return columns.size();
+}
+
+// Time efficiency: O(number of languages)
+int MultiDictionary::findLanguage(const string& languageName) const {
+
+	for (size_t c = 0; c < columns.size(); c++) {
+		const string& name = columns[c].name;
+		bool matches = (name.length() == languageName.length());
+
+		for (size_t i = 0; matches && i < name.length(); i++)
+			matches = (tolower((unsigned char)name[i]) == tolower((unsigned char)languageName[i]));
+
+		if (matches)
+			return c;
+	}
+
+	return -1;
+}
+
+// Time efficiency: O(1)
+void MultiDictionary::insert(const string& english, const vector<string>& translations) {
+
+	stagedEnglish.push_back(english);
+	stagedTranslations.push_back(translations);
+	stagedTranslations.back().resize(columns.size());
+}
+
+// Time efficiency: O(n log2 n)
+void MultiDictionary::build(vector<string>& duplicates) {
+
+	vector<unsigned int> order(stagedEnglish.size());
+	for (size_t i = 0; i < order.size(); i++)
+		order[i] = i;
+
+	StagedRowLess rowLess = { &stagedEnglish };
+	sort(order.begin(), order.end(), rowLess);
+
+	englishArena.clear();
+	englishOffsets.assign(1, 0);
+	for (size_t c = 0; c < columns.size(); c++) {
+		columns[c].arena.clear();
+		columns[c].offsets.assign(1, 0);
+	}
+
+	// Lay out the key index and every column in sorted word order
+	for (size_t k = 0; k < order.size(); k++) {
+		const string& english = stagedEnglish[order[k]];
+
+		if (k > 0 && english == stagedEnglish[order[k - 1]]) {
+			duplicates.push_back(english);
+			continue;
+		}
+
+		englishArena += english;
+		englishOffsets.push_back(englishArena.length());
+
+		for (size_t c = 0; c < columns.size(); c++) {
+			columns[c].arena += stagedTranslations[order[k]][c];
+			columns[c].offsets.push_back(columns[c].arena.length());
+		}
+	}
+
+	// The staged rows are no longer needed
+	vector<string>().swap(stagedEnglish);
+	vector< vector<string> >().swap(stagedTranslations);
+}
+
+// Time efficiency: O(log2 n)
+WordPair MultiDictionary::retrieve(const WordPair& targetElement, int language)
+const throw(ElementDoesNotExistInBSTException) {
+
+	string english = targetElement.getEnglish();
+	int index = find(english);
+
+	if (index < 0 || language < 0 || language >= (int)columns.size())
+		throw ElementDoesNotExistInBSTException("Element does not exist");
+
+	const TranslationColumn& column = columns[language];
+
+	return WordPair(english, column.arena.substr(column.offsets[index],
+		column.offsets[index + 1] - column.offsets[index]));
+}
+
+
+// Private methods
+
+// Returns the index of "english" in the key index, or -1 if it is not there
+int MultiDictionary::find(const string& english) const {
+
+	int low = 0;
+	int high = getElementCount() - 1;
+
+	while (low <= high) {
+		int middle = low + (high - low) / 2;
+		int comparison = compareKeys(englishArena.data() + englishOffsets[middle],
+			englishOffsets[middle + 1] - englishOffsets[middle], english.data(), english.length());
+
+		if (comparison == 0)
+			return middle;
+		if (comparison < 0)
+			low = middle + 1;
+		else
+			high = middle - 1;
+	}
+
+	return -1;
+}
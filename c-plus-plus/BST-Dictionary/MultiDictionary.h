@@ -0,0 +1,84 @@
+/*
+ * MultiDictionary.h
+ *
+ * Description: Translation dictionary from English into several languages.
+ *              The English words are stored once, sorted, in a single
+ *              character arena and searched by binary search. Each language
+ *              is a column: its translations are stored contiguously in a
+ *              separate arena, in the same order as the English words, so
+ *              the index found for a word selects its translation in every
+ *              language.
+ *
+ *              Words are staged with insert() and become searchable once
+ *              build() is called.
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "WordPair.h"
+#include "ElementDoesNotExistInBSTException.h"
+
+using namespace std;
+
+
+// Models one language column of a MultiDictionary
+struct TranslationColumn {
+	string name;					// Language name, e.g. "french"
+	string arena;					// Concatenated translations
+	vector<unsigned int> offsets;	// Translation i is arena[offsets[i], offsets[i + 1])
+};
+
+
+class MultiDictionary {
+
+private:
+	string englishArena;				// Concatenated English words, sorted
+	vector<unsigned int> englishOffsets;	// Word i is englishArena[englishOffsets[i], englishOffsets[i + 1])
+	vector<TranslationColumn> columns;	// One column per language
+
+	// Rows staged by insert() until build()
+	vector<string> stagedEnglish;
+	vector< vector<string> > stagedTranslations;
+
+	// Utility methods
+	int find(const string& english) const;
+
+public:
+	// Constructor
+	MultiDictionary(const vector<string>& languageNames);
+
+	// Time efficiency: O(1)
+	int getElementCount() const;
+
+	// Time efficiency: O(1)
+	int getLanguageCount() const;
+
+	// Description: Returns the column index of the named language (ignoring
+	//              case), or -1 if it is not loaded.
+	// Time efficiency: O(number of languages)
+	int findLanguage(const string& languageName) const;
+
+	// Description: Stages an English word and its translations, one per
+	//              language in column order. Missing translations are empty.
+	// Time efficiency: O(1)
+	void insert(const string& english, const vector<string>& translations);
+
+	// Description: Sorts the staged words and lays out the key index and the
+	//              language columns. When a word was staged more than once,
+	//              its first translations are kept and the word is appended
+	//              to "duplicates".
+	// Time efficiency: O(n log2 n)
+	void build(vector<string>& duplicates);
+
+	// Description: Returns the pair of targetElement's English word and its
+	//              translation in the given language column.
+	// Exceptions: Throws ElementDoesNotExistInBSTException if the word is not in the dictionary.
+	// Time efficiency: O(log2 n)
+	WordPair retrieve(const WordPair& targetElement, int language) const throw(ElementDoesNotExistInBSTException);
+
+}; // end MultiDictionary
@@ -0,0 +1,41 @@
+/*
+ * PerfectHash.h
+ *
+ * Description: Seeded string hash shared by the dictionary generator (DictGen)
+ *              and the compiled dictionary lookup (CompiledDictionary).
+ *
+ *              The compiled dictionary uses a "hash and displace" minimal
+ *              perfect hash: a key is first hashed with seed 0 to pick a
+ *              bucket, and the displacement seed stored for that bucket is
+ *              then used to hash the key to its slot. The generator and the
+ *              lookup must agree on this function bit for bit.
+ *
+ * Author: Andrew Adams
+ * Date of last modification: October 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+
+// Description: Hashes the first "length" bytes of "key" using "seed".
+// Time Efficiency: O(length)
+inline unsigned int perfectHash(const char* key, size_t length, unsigned int seed) {
+
+	unsigned int hash = 2166136261u ^ (seed * 0x9E3779B9u);
+
+	// FNV-1a over the key bytes
+	for (size_t i = 0; i < length; i++) {
+		hash ^= (unsigned char)key[i];
+		hash *= 16777619u;
+	}
+
+	// Final avalanche so that nearby seeds give unrelated slots
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6Bu;
+	hash ^= hash >> 13;
+	hash *= 0xC2B2AE35u;
+	hash ^= hash >> 16;
+
+	return hash;
+}
@@ -17,8 +17,11 @@
 #include <iomanip>
 #include <fstream>
 #include <string>
+#include <vector>
 #include "BST.h"
 #include "WordPair.h"
+#include "CompiledDictionary.h"
+#include "MultiDictionary.h"
 #include "ElementAlreadyExistsInBSTException.h"
 #include "ElementDoesNotExistInBSTException.h"
 
@@ -28,6 +31,136 @@ void display(WordPair& anElement) {
 } // end of display
 
 
+// Splits aLine at every occurrence of delimiter
+vector<string> splitLine(string aLine, const string& delimiter) {
+
+  vector<string> fields;
+  size_t pos = 0;
+
+  while ( (pos = aLine.find(delimiter)) != string::npos ) {
+    fields.push_back(aLine.substr(0, pos));
+    aLine.erase(0, pos + delimiter.length());
+  }
+  fields.push_back(aLine);
+
+  return fields;
+} // end of splitLine
+
+
+// Loads the multi-language dictionary file and translates words read from
+// the terminal into the named language. The file's first line names the
+// columns, e.g. "english:french:spanish:german".
+void translateInto(const char* languageName) {
+
+  string aLine = "";
+  string aWord = "";
+  string filename = "multiDataFile.txt";
+  string delimiter = ":";
+  WordPair translated;
+
+  ifstream myfile (filename);
+  if (!myfile.is_open() || !getline (myfile,aLine)) {
+    cout << "Unable to open file";
+    return;
+  }
+
+  // Every column after "english" is a language
+  vector<string> languages = splitLine(aLine, delimiter);
+  languages.erase(languages.begin());
+  MultiDictionary theTranslator(languages);
+
+  int language = theTranslator.findLanguage(languageName);
+  if (language < 0) {
+    cout << "Language '" << languageName << "' not found!" << endl;
+    return;
+  }
+
+  cout << "Reading from a file:" << endl;
+  while ( getline (myfile,aLine) ) {
+    vector<string> fields = splitLine(aLine, delimiter);
+    string englishW = fields[0];
+    fields.erase(fields.begin());
+    theTranslator.insert(englishW, fields);
+  }
+  myfile.close();
+
+  vector<string> duplicates;
+  theTranslator.build(duplicates);
+  for (size_t i = 0; i < duplicates.size(); i++)
+    cout << ElementAlreadyExistsInBSTException("Element already exists").what() << " => " << duplicates[i] << endl;
+
+  // while user has not entered CTRL+D
+  while ( getline(cin, aWord) ) {
+    WordPair aWordPair(aWord);
+    try {
+        translated = theTranslator.retrieve(aWordPair, language);
+        cout << translated.getEnglish() << ":" << translated.getTranslation() << endl;
+    }
+    catch (ElementDoesNotExistInBSTException& anException) {
+        cout << "Translation for '" << aWordPair.getEnglish() << "' not found!" << endl;
+    }
+  }
+} // end of translateInto
+
+
+// Reads a delta file of changes and applies it to theTranslator as one batch.
+// Each line is one change:
+//   +english:translation   adds a word
+//   =english:translation   updates the translation of a word
+//   -english               removes a word
+void applyDeltaFile(BST<WordPair>* theTranslator, const char* filename) {
+
+  vector< BSTChange<WordPair> > changes;
+  vector< BSTChange<WordPair> > rejected;
+  BSTChange<WordPair> aChange;
+  string aLine = "";
+  string delimiter = ":";
+  size_t pos = 0;
+
+  ifstream deltaFile (filename);
+  if (!deltaFile.is_open()) {
+    cout << "Unable to open file " << filename << endl;
+    return;
+  }
+
+  cout << "Applying changes from a file:" << endl;
+  while ( getline (deltaFile,aLine) ) {
+    if (aLine.empty())
+      continue;
+
+    if (aLine[0] == '+')
+      aChange.type = ADD_ELEMENT;
+    else if (aLine[0] == '=')
+      aChange.type = UPDATE_ELEMENT;
+    else if (aLine[0] == '-')
+      aChange.type = REMOVE_ELEMENT;
+    else {
+      cout << "Unknown change => " << aLine << endl;
+      continue;
+    }
+
+    aLine.erase(0, 1);
+    pos = aLine.find(delimiter);
+    if (pos == string::npos)
+      aChange.element = WordPair(aLine);
+    else
+      aChange.element = WordPair(aLine.substr(0, pos), aLine.substr(pos + delimiter.length()));
+    changes.push_back(aChange);
+  }
+  deltaFile.close();
+
+  theTranslator->applyChanges(changes, rejected);
+
+  for (size_t i = 0; i < rejected.size(); i++) {
+    if (rejected[i].type == ADD_ELEMENT)
+      cout << ElementAlreadyExistsInBSTException("Element already exists").what();
+    else
+      cout << ElementDoesNotExistInBSTException("Element does not exist").what();
+    cout << " => " << rejected[i].element.getEnglish() << ":" << rejected[i].element.getTranslation() << endl;
+  }
+} // end of applyDeltaFile
+
+
 int main(int argc, char *argv[]) {
 
   BST<WordPair>* theTranslator = new BST<WordPair>();
@@ -41,6 +174,28 @@ int main(int argc, char *argv[]) {
   size_t pos = 0;
   WordPair translated;
  
+  // If user entered "Compiled" at the command line, answer lookups from the
+  // dictionary compiled into tApp at build time; no file is read
+  if ( ( argc > 1 ) && ( strcmp(argv[1], "Compiled") == 0) ) {
+     while ( getline(cin, aWord) ) {
+        WordPair aWordPair(aWord);
+        try {
+            translated = CompiledDictionary::retrieve(aWordPair);
+            cout << translated.getEnglish() << ":" << translated.getTranslation() << endl;
+        }
+        catch (ElementDoesNotExistInBSTException& anException) {
+            cout << "Translation for '" << aWordPair.getEnglish() << "' not found!" << endl;
+        }
+     }
+     return 0;
+  }
+
+  // If user entered "Language" and a language name at the command line,
+  // translate into that language using the multi-language dictionary
+  if ( ( argc > 2 ) && ( strcmp(argv[1], "Language") == 0) ) {
+     translateInto(argv[2]);
+     return 0;
+  }
   
   ifstream myfile (filename);
   if (myfile.is_open()) {
@@ -64,12 +219,18 @@ int main(int argc, char *argv[]) {
     }
     myfile.close();
 
+    // If user entered "Update" and a delta file name at the command line,
+    // apply the delta file's changes before translating
+    bool updating = ( argc > 2 ) && ( strcmp(argv[1], "Update") == 0 );
+    if (updating)
+        applyDeltaFile(theTranslator, argv[2]);
+
     // If user entered "Display" at the command line
     if ( ( argc > 1 ) && ( strcmp(argv[1], "Display") == 0) ) {
         // cout << "Printing the Translator:" << endl; // For debugging purposes
         theTranslator->traverseInOrder(display);
     }
-    else if (argc == 1) {
+    else if (argc == 1 || updating) {
        // while user has not entered CTRL+D
        while ( getline(cin, aWord) ) {   
           //cout << "Read: " << aWord << endl; // For debugging purposes
@@ -46,10 +46,10 @@ void WordPair::setTranslation(string translation) {
 // Overloaded Operators
 bool WordPair::operator==(const WordPair& rhs) const {
 
-	return (this->english.compare(rhs.getEnglish()) ) == 0;
+	return (this->english.compare(rhs.english) ) == 0;
 } // end of operator==
 
 bool WordPair::operator<(const WordPair& rhs) const {
 
-	return (this->english.compare(rhs.getEnglish()) ) < 0;
+	return (this->english.compare(rhs.english) ) < 0;
 } // end of operator<
\ No newline at end of file
@@ -0,0 +1,41 @@
+/*
+* ArrivalGenerator.cpp
+*
+* Class Description: Generates random bank customer arrivals for Monte Carlo
+*					 replications of the simulation.
+* Class Invariant: The generator is not changed by generate().
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#include <algorithm>
+#include "ArrivalGenerator.h"
+
+using namespace std;
+
+
+// Poisson constructor
+// Precondition: Both means are positive.
+ArrivalGenerator::ArrivalGenerator(double interarrivalMean, double serviceMean) {
+	empirical = false;
+	meanInterarrival = interarrivalMean;
+	meanService = serviceMean;
+}
+
+
+// Empirical constructor
+// Precondition: The trace holds at least two customers, and the two
+//				 vectors have the same size.
+ArrivalGenerator::ArrivalGenerator(vector<int> arrivalTimes, const vector<int>& transactionLengths) {
+
+	empirical = true;
+	meanInterarrival = 0.0;
+	meanService = 0.0;
+	lengths = transactionLengths;
+
+	// The gaps are taken between arrivals in time order, whatever the
+	// order of the trace
+	sort(arrivalTimes.begin(), arrivalTimes.end());
+	for (size_t i = 1; i < arrivalTimes.size(); i++)
+		gaps.push_back(arrivalTimes[i] - arrivalTimes[i - 1]);
+}
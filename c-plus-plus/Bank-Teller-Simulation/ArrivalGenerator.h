@@ -0,0 +1,102 @@
+/*
+* ArrivalGenerator.h
+*
+* Class Description: Generates random bank customer arrivals for Monte Carlo
+*					 replications of the simulation.
+*					 A Poisson generator draws exponential gaps between
+*					 arrivals and exponential transaction lengths with the
+*					 given means. An empirical generator resamples, with
+*					 replacement, the gaps between arrivals and the
+*					 transaction lengths of a recorded trace.
+*					 Times are whole numbers, as in the input files;
+*					 transaction lengths are at least 1.
+* Class Invariant: The generator is not changed by generate(), so one
+*				   generator can be shared by several threads, each with its
+*				   own random number engine.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <climits>
+#include <random>
+#include <vector>
+#include "Event.h"
+
+using namespace std;
+
+class ArrivalGenerator {
+
+	private:
+		bool empirical;					// Resample a trace rather than draw exponentials
+		double meanInterarrival;		// Mean time between arrivals, for Poisson arrivals
+		double meanService;				// Mean transaction length, for Poisson arrivals
+		vector<int> gaps;				// Gaps between the trace's sorted arrival times
+		vector<int> lengths;			// The trace's transaction lengths
+
+	public:
+		// Poisson constructor
+		// Precondition: Both means are positive.
+		ArrivalGenerator(double interarrivalMean, double serviceMean);
+
+		// Empirical constructor
+		// Precondition: The trace holds at least two customers, and the two
+		//				 vectors have the same size.
+		ArrivalGenerator(vector<int> arrivalTimes, const vector<int>& transactionLengths);
+
+		// Description: Enqueues "customers" arrival events into eventQueue,
+		//				drawn with randomEngine, starting at time 0. Returns
+		//				"false", having enqueued only the arrivals before
+		//				it, if an arrival time would pass INT_MAX.
+		// Postcondition: The generator is unchanged.
+		// Time Efficiency: O(customers) plus the cost of the enqueues
+		template <class EventQueue>
+		bool generate(EventQueue& eventQueue, int customers, mt19937_64& randomEngine) const;
+
+}; // end ArrivalGenerator
+
+
+// Description: Enqueues "customers" arrival events into eventQueue,
+//				drawn with randomEngine, starting at time 0. Returns
+//				"false", having enqueued only the arrivals before it, if
+//				an arrival time would pass INT_MAX.
+// Postcondition: The generator is unchanged.
+// Time Efficiency: O(customers) plus the cost of the enqueues
+template <class EventQueue>
+bool ArrivalGenerator::generate(EventQueue& eventQueue, int customers, mt19937_64& randomEngine) const {
+
+	if (empirical) {
+		uniform_int_distribution<size_t> gapIndex(0, gaps.size() - 1);
+		uniform_int_distribution<size_t> lengthIndex(0, lengths.size() - 1);
+		long long arrivalTime = 0;
+
+		for (int i = 0; i < customers; i++) {
+			if (arrivalTime > INT_MAX)
+				return false;
+			eventQueue.enqueue(Event(ARRIVAL, (int)arrivalTime, lengths[lengthIndex(randomEngine)]));
+			arrivalTime += gaps[gapIndex(randomEngine)];
+		}
+	}
+	else {
+		exponential_distribution<double> gap(1.0 / meanInterarrival);
+		exponential_distribution<double> length(1.0 / meanService);
+		double arrivalTime = 0.0;
+
+		// Arrival times accumulate in double precision and are truncated,
+		// so rounding does not drift over a long replication
+		for (int i = 0; i < customers; i++) {
+			double transactionLength = length(randomEngine) + 0.5;
+			if (transactionLength < 1.0)
+				transactionLength = 1.0;
+			else if (transactionLength > INT_MAX)
+				transactionLength = INT_MAX;
+
+			if (arrivalTime >= INT_MAX + 1.0)
+				return false;
+			eventQueue.enqueue(Event(ARRIVAL, (int)arrivalTime, (int)transactionLength));
+			arrivalTime += gap(randomEngine);
+		}
+	}
+
+	return true;
+}
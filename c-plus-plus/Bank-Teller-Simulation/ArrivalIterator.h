@@ -0,0 +1,68 @@
+/*
+* ArrivalIterator.h
+*
+* Class Description: An input iterator over the arrivals of a trace reader
+*					 (TraceReader or BinaryTraceReader, or anything with a
+*					 method bool next(Event&)), so an event queue can be
+*					 built straight from the input with its range
+*					 constructor, without first collecting the arrivals.
+*					 A default-constructed iterator marks the end.
+* Class Invariant: "reader" is NULL once the trace has ended; until then
+*				   "current" holds the arrival the iterator points at.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include "Event.h"
+
+using namespace std;
+
+template <class ArrivalReader>
+class ArrivalIterator {
+
+	private:
+		ArrivalReader* reader;		// Reader of the trace, or NULL at the end
+		Event current;				// Arrival the iterator points at
+
+	public:
+		typedef input_iterator_tag iterator_category;
+		typedef Event value_type;
+		typedef ptrdiff_t difference_type;
+		typedef const Event* pointer;
+		typedef const Event& reference;
+
+		// Constructor for the end of any trace
+		ArrivalIterator() : reader(NULL) {}
+
+		// Constructor; reads the first arrival from "trace"
+		ArrivalIterator(ArrivalReader& trace) : reader(&trace) {
+			++*this;
+		}
+
+		// Description: Returns the arrival the iterator points at.
+		// Precondition: The iterator is not at the end.
+		const Event& operator*() const {
+			return current;
+		}
+
+		// Description: Reads the next arrival, or moves to the end.
+		ArrivalIterator<ArrivalReader>& operator++() {
+			if (!reader->next(current))
+				reader = NULL;
+			return *this;
+		}
+
+		// Description: Returns "true" if both iterators are at the end, or
+		//				both read the same trace.
+		bool operator==(const ArrivalIterator<ArrivalReader>& rhs) const {
+			return reader == rhs.reader;
+		}
+
+		bool operator!=(const ArrivalIterator<ArrivalReader>& rhs) const {
+			return reader != rhs.reader;
+		}
+
+}; // end ArrivalIterator
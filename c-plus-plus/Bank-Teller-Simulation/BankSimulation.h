@@ -0,0 +1,1287 @@
+/*
+* BankSimulation.h
+*
+* Class Description: The event-driven engine of the bank simulation. Customers
+*					 arrive, wait in line if no teller can take them, and are
+*					 served by one of k tellers. Each departure event carries
+*					 the teller it frees.
+*					 With SHARED_LINE, all customers wait in one line and the
+*					 lowest-numbered idle teller takes the next customer; idle
+*					 tellers are kept in a min-heap, so choosing one is
+*					 O(log k). With TELLER_LINES, every teller has its own line
+*					 and an arriving customer joins the teller with the fewest
+*					 customers (in line or being served), lowest-numbered
+*					 first; teller loads are kept ordered in a set, so this is
+*					 also O(log k).
+*					 The event queue type is a template parameter, so any of
+*					 the priority queues (PriorityQueue, HeapPriorityQueue,
+*					 RadixHeap) can drive the simulation.
+*					 run() takes every arrival up front in an event queue,
+*					 which it takes over by moving rather than copying.
+*					 runSorted() instead reads arrivals one at a time from a
+*					 source sorted by arrival time and merges them with a
+*					 queue holding only departures, so its memory is
+*					 proportional to the number of customers in the bank,
+*					 not to the length of the trace.
+*					 Waiting times, line lengths and teller utilization are
+*					 kept in a SimulationStatistics as the run goes.
+*					 Customers can be impatient. With setPatience(), each
+*					 arrival is given an exponentially distributed patience,
+*					 and a customer still in line when it runs out reneges,
+*					 leaving unserved; with setBalkingLimit(), a customer who
+*					 would join a line already that long balks, leaving at
+*					 once. Patience deadlines are kept in an indexed heap and
+*					 the lines are indexed queues, so a customer served in
+*					 time has their deadline cancelled in O(log n), and one
+*					 who reneges is taken from the middle of their line in
+*					 O(1), without scanning either.
+*					 Customers can also come in priority classes. With
+*					 setClassMix(), each arrival is given a class drawn from
+*					 a weighted mix, and every line serves class 0 first,
+*					 then class 1, and so on; a line is a MultiClassLine, so
+*					 finding the next customer stays O(1). Waiting times are
+*					 kept per class.
+*					 A long run can be checkpointed. With setCheckpoints(),
+*					 every so many events the engine copies its whole
+*					 state, event queue included, and a Checkpointer
+*					 encodes and saves the copy on another thread while
+*					 the run carries on; a checkpoint due while the last is
+*					 still being saved is skipped rather than waited for.
+*					 resume() and resumeSorted() load the latest checkpoint
+*					 and finish the run with exactly the results it would
+*					 have had. The event queue is saved as it is held, each
+*					 event with a rank that orders equal events, and the
+*					 other queues in the order their elements would leave;
+*					 all are refilled in that order, so ties still break as
+*					 before.
+*					 Custom metrics are gathered by an observer, the second
+*					 template parameter (see SimulationObserver.h), whose
+*					 hooks are called as customers arrive, change the
+*					 length of a line, start service and depart. The
+*					 statistics are an observer too, called first. The
+*					 default NullObserver compiles away. A custom
+*					 observer is copied with the rest of the state when a
+*					 checkpoint is taken, but is not saved in it.
+* Class Invariant: A teller is idle only if its line (or the shared line) is
+*				   empty. With one teller, both policies reproduce the
+*				   original single-teller simulation.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <algorithm>
+#include <climits>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <utility>
+#include <vector>
+#include "Event.h"
+#include "MultiClassLine.h"
+#include "HeapPriorityQueue.h"
+#include "IndexedHeapPriorityQueue.h"
+#include "BinaryTraceWriter.h"
+#include "EventLog.h"
+#include "Checkpointer.h"
+#include "CheckpointReader.h"
+#include "SimulationObserver.h"
+#include "SimulationStatistics.h"
+#include "EmptyDataCollectionException.h"
+
+using namespace std;
+
+// How customers line up for the tellers
+enum LinePolicy {
+	SHARED_LINE,	// One line; the next customer goes to any idle teller
+	TELLER_LINES	// One line per teller; customers join the shortest
+};
+
+// How customers behave, for engines set up together, as by setBehavior()
+struct CustomerBehavior {
+	double meanPatience;			// Mean patience of customers, or 0 for unlimited
+	int balkingLimit;				// Line length customers will not join, or 0 for none
+	vector<double> classWeights;	// Share of customers in each priority class
+	unsigned long long seed;		// Seed of the customers' patience and classes
+};
+
+template <class EventQueue, class Observer = NullObserver>
+class BankSimulation {
+
+	private:
+		// A customer waiting in line, and the handle of their patience deadline
+		struct WaitingCustomer {
+			Event customer;
+			int deadline;		// Handle in "deadlines", or NO_DEADLINE
+		};
+
+		// When a waiting customer's patience runs out, and where they wait
+		struct PatienceDeadline {
+			int time;			// Time the customer reneges if not yet served
+			int line;			// Teller whose line they are in, or 0 for the shared line
+			int position;		// Their handle in that line
+
+			bool operator>(const PatienceDeadline& rhs) const {
+				return time > rhs.time;
+			}
+		};
+
+		typedef MultiClassLine<WaitingCustomer, CUSTOMER_CLASS_COUNT> Line;
+
+		static const int NO_DEADLINE = -1;	// Deadline of a customer with unlimited patience
+
+		int tellerCount;				// Number of tellers, k
+		LinePolicy linePolicy;			// How customers line up
+		EventLog* narration;			// Where events are narrated, or NULL for none
+		BinaryTraceWriter* customerLog;	// Where customers are logged, or NULL for none
+		double meanPatience;			// Mean patience of customers, or 0 for unlimited
+		unsigned long long patienceSeed;	// Seed of every run's patience draws
+		int balkingLimit;				// Line length customers will not join, or 0 for none
+		vector<double> classWeights;	// Share of arrivals in each class
+		unsigned long long classSeed;	// Seed of every run's class draws
+
+		Line sharedLine;						// Customers waiting, with SHARED_LINE
+		HeapPriorityQueue<int> idleTellers;		// Idle tellers, with SHARED_LINE
+		vector<Line> tellerLines;				// Each teller's line, with TELLER_LINES
+		vector<int> tellerLoads;				// Customers at each teller, with TELLER_LINES
+		set< pair<int, int> > tellersByLoad;	// (load, teller) pairs, with TELLER_LINES
+		IndexedHeapPriorityQueue<PatienceDeadline> deadlines;	// Patience of customers in line
+		mt19937_64 patienceEngine;				// Draws each arrival's patience
+		mt19937_64 classEngine;					// Draws each arrival's class
+		discrete_distribution<int> classDistribution;	// Classes in proportion to classWeights
+
+		Checkpointer* checkpointer;		// Where checkpoints are saved, or NULL for none
+		long long checkpointInterval;	// Events between checkpoints
+		long long eventsProcessed;		// Events processed so far in this run
+		long long arrivalsProcessed;	// Arrivals processed so far in this run
+		long long departuresRejected;	// Departures the event queue would not take or past INT_MAX
+
+		ObserverPair<SimulationStatistics, Observer> observers;	// Statistics of the current or last run, then the custom observer
+
+		// Description: Narrates "event" if narration is on.
+		// Time Efficiency: O(1)
+		void narrate(const Event& event);
+
+		// Description: Resets the tellers, lines and totals for a new run.
+		// Time Efficiency: O(k log k)
+		void reset();
+
+		// Description: Returns the line customers of "teller" wait in.
+		// Time Efficiency: O(1)
+		Line& lineOf(int teller);
+
+		// Description: Sends an arriving customer to a teller or a line, or
+		//				away if they balk.
+		// Time Efficiency: O(log k + log w) for w customers waiting, plus
+		//					one event queue enqueue
+		void processArrival(EventQueue& eventPriorityQueue, const Event& arrival);
+
+		// Description: Adds "customer" to the back of the line of "teller",
+		//				with a deadline "patience" after their arrival if
+		//				customers are impatient.
+		// Time Efficiency: O(log w) for w customers waiting
+		void joinLine(int teller, const Event& customer, int patience);
+
+		// Description: Frees the departing customer's teller, who serves the
+		//				next customer in line or becomes idle.
+		// Time Efficiency: O(log k + log w) for w customers waiting, plus
+		//					one event queue enqueue
+		void processDeparture(EventQueue& eventPriorityQueue, const Event& departure);
+
+		// Description: Removes from their lines the customers whose patience
+		//				ran out before "time". A customer whose patience runs
+		//				out at the same time as a teller frees up is served.
+		// Time Efficiency: O(log k + log w) per customer removed, for w
+		//					customers waiting
+		void processReneging(int time);
+
+		// Description: Starts serving "customer" at "teller" at currentTime and
+		//				schedules the departure. Their time spent waiting is
+		//				added to the statistics.
+		// Time Efficiency: One event queue enqueue
+		void startService(EventQueue& eventPriorityQueue, const Event& customer,
+			int teller, int currentTime);
+
+		// Description: Changes the number of customers at "teller" by "change".
+		// Precondition: linePolicy is TELLER_LINES.
+		// Time Efficiency: O(log k)
+		void changeLoad(int teller, int change);
+
+		// Description: Processes every event in eventPriorityQueue, and any
+		//				departures they lead to, in time order.
+		// Time Efficiency: O(n (log k + cost of the event queue))
+		void processEvents(EventQueue& eventPriorityQueue);
+
+		// Description: Processes the arrivals read from "arrivals" and the
+		//				departures in "departures", in time order, and
+		//				returns "false" if an arrival is earlier than the one
+		//				before it.
+		// Time Efficiency: O(n (log k + cost of the event queue))
+		template <class ArrivalSource>
+		bool processSorted(EventQueue& departures, ArrivalSource& arrivals);
+
+		// Description: Counts an event as processed, and every
+		//				checkpointInterval events hands a copy of the state
+		//				and of "events" to the checkpointer, unless it is
+		//				still saving the last one.
+		// Time Efficiency: O(1), or O(state) to take a copy
+		void countEvent(const EventQueue& events, bool streaming);
+
+		// Description: Writes the state of the run, with the elements of
+		//				"events" and their ranks, to "checkpoint".
+		// Time Efficiency: O(n + c log c) for n events and c customers waiting
+		void writeCheckpoint(CheckpointWriter& checkpoint, const EventQueue& events, bool streaming) const;
+
+		// Description: Replaces the state of the run, after reset(), and
+		//				"events" with those in "checkpoint", and returns
+		//				"false" if it cannot be read, was taken by the other
+		//				kind of run or with other options.
+		// Time Efficiency: O(n log n) for n events and customers waiting
+		bool readCheckpoint(CheckpointReader& checkpoint, EventQueue& events, bool streaming);
+
+	public:
+		// Constructor
+		// Precondition: tellers is between 1 and 65536.
+		BankSimulation(int tellers = 1, LinePolicy policy = SHARED_LINE);
+
+		// Description: Narrates each event to "output" as it is processed, or
+		//				runs silently if "output" is NULL (the default).
+		// Time Efficiency: O(1)
+		void setNarration(EventLog* output);
+
+		// Description: Appends a row to "log" for each customer as their
+		//				service starts, or logs nothing if "log" is NULL (the
+		//				default). The log's columns must be CUSTOMER_LOG_COLUMNS.
+		// Time Efficiency: O(1)
+		void setCustomerLog(BinaryTraceWriter* log);
+
+		// Description: Makes customers impatient: each is given a patience
+		//				drawn from an exponential distribution with mean
+		//				"mean", rounded to a whole time, and reneges if still
+		//				in line when it runs out. Every run draws from a
+		//				stream seeded with "seed", so runs are repeatable. A
+		//				mean of 0 (the default) makes customers wait as long
+		//				as it takes.
+		// Precondition: mean is not negative.
+		// Time Efficiency: O(1)
+		void setPatience(double mean, unsigned long long seed);
+
+		// Description: Makes customers balk at lines that already hold
+		//				"lineLength" customers or more, or never if it is 0
+		//				(the default).
+		// Precondition: lineLength is not negative.
+		// Time Efficiency: O(1)
+		void setBalkingLimit(int lineLength);
+
+		// Description: Puts customers in priority classes: each arrival is
+		//				class c with probability proportional to weights[c],
+		//				and customers of a lower class are served before
+		//				those of a higher one who are in the same line. Every
+		//				run draws from a stream seeded with "seed". With one
+		//				weight (the default) every customer is class 0 and
+		//				nothing is drawn.
+		// Precondition: weights has 1 to CUSTOMER_CLASS_COUNT elements, none
+		//				 negative, with a positive sum.
+		// Time Efficiency: O(CUSTOMER_CLASS_COUNT)
+		void setClassMix(const vector<double>& weights, unsigned long long seed);
+
+		// Description: Sets the patience, balking limit and class mix of
+		//				"behavior" at once, all seeded with its seed, as
+		//				setPatience(), setBalkingLimit() and setClassMix() do.
+		// Precondition: As for those three.
+		// Time Efficiency: O(CUSTOMER_CLASS_COUNT)
+		void setBehavior(const CustomerBehavior& behavior);
+
+		// Description: Saves a checkpoint with "checkpoints" every "interval"
+		//				events, or none if "checkpoints" is NULL (the
+		//				default). Each checkpoint replaces the one before.
+		// Precondition: interval is positive.
+		// Time Efficiency: O(1)
+		void setCheckpoints(Checkpointer* checkpoints, long long interval);
+
+		// Description: Processes every event in eventPriorityQueue, and any
+		//				departures they lead to, in time order. The queue is
+		//				moved into the simulation, not copied; pass a copy,
+		//				run(EventQueue(queue)), to keep the original.
+		// Precondition: eventPriorityQueue holds only arrival events.
+		// Postcondition: eventPriorityQueue is empty.
+		// Time Efficiency: O(n (log k + cost of the event queue))
+		void run(EventQueue&& arrivals);
+
+		// Description: Processes the arrivals read from "arrivals", which has a
+		//				method bool next(Event&) returning "false" at the end,
+		//				and the departures they lead to, in time order.
+		//				Returns "false", having stopped early, if an arrival is
+		//				earlier than the one before it.
+		// Precondition: Arrivals are sorted by time.
+		// Postcondition: Arrivals and departures at the same time are processed
+		//				  in the same order as by run().
+		// Time Efficiency: O(n (log k + cost of the event queue)), with the event
+		//					queue holding at most k departures
+		template <class ArrivalSource>
+		bool runSorted(ArrivalSource& arrivals);
+
+		// Description: Finishes the run() that saved "checkpoint", with the
+		//				same final results as if it had not been stopped.
+		//				Returns "false", having done nothing, if the
+		//				checkpoint cannot be read or was taken by runSorted()
+		//				or with other options; checkpoint.getError() says why.
+		// Precondition: The options set are those of the run that saved it.
+		// Time Efficiency: O(n (log k + cost of the event queue)) for the
+		//					n events left
+		bool resume(CheckpointReader& checkpoint);
+
+		// Description: Finishes the runSorted() that saved "checkpoint", on
+		//				the same arrivals, with the same final results as if
+		//				it had not been stopped; the arrivals it had already
+		//				processed are read and skipped. Returns "false" if the
+		//				checkpoint cannot be used, as for resume(), or if
+		//				"arrivals" runs out before the point it was taken or
+		//				is not sorted.
+		// Precondition: The options set are those of the run that saved it.
+		// Time Efficiency: O(n (log k + cost of the event queue))
+		template <class ArrivalSource>
+		bool resumeSorted(CheckpointReader& checkpoint, ArrivalSource& arrivals);
+
+		// Description: Returns the number of customers served by the last run.
+		// Time Efficiency: O(1)
+		long long getCustomersProcessed() const;
+
+		// Description: Returns the average time customers of the last run
+		//				spent waiting in line.
+		// Time Efficiency: O(1)
+		float getAverageWait() const;
+
+		// Description: Returns the number of departures of the last run
+		//				that the event queue refused, such as a RadixHeap's
+		//				for a time before 0, or whose time would pass
+		//				INT_MAX; those customers never leave. A run is only
+		//				valid if this is 0.
+		// Time Efficiency: O(1)
+		long long getDeparturesRejected() const;
+
+		// Description: Returns the statistics of the last run.
+		// Time Efficiency: O(1)
+		const SimulationStatistics& getStatistics() const;
+
+		// Description: Returns the custom observer, to set it up before a
+		//				run or read what it gathered after.
+		// Time Efficiency: O(1)
+		Observer& getObserver();
+		const Observer& getObserver() const;
+
+}; // end BankSimulation
+
+
+// Constructor
+template <class EventQueue, class Observer>
+BankSimulation<EventQueue, Observer>::BankSimulation(int tellers, LinePolicy policy) {
+	tellerCount = tellers;
+	linePolicy = policy;
+	narration = NULL;
+	customerLog = NULL;
+	meanPatience = 0.0;
+	patienceSeed = 0;
+	balkingLimit = 0;
+	classWeights.assign(1, 1.0);
+	classSeed = 0;
+	checkpointer = NULL;
+	checkpointInterval = 1;
+	eventsProcessed = 0;
+	arrivalsProcessed = 0;
+	departuresRejected = 0;
+	observers.first.reset(tellers);
+}
+
+
+// Description: Narrates each event to "output" as it is processed, or
+//				runs silently if "output" is NULL (the default).
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::setNarration(EventLog* output) {
+	narration = output;
+}
+
+
+// Description: Appends a row to "log" for each customer as their
+//				service starts, or logs nothing if "log" is NULL (the
+//				default). The log's columns must be CUSTOMER_LOG_COLUMNS.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::setCustomerLog(BinaryTraceWriter* log) {
+	customerLog = log;
+}
+
+
+// Description: Makes customers impatient: each is given a patience
+//				drawn from an exponential distribution with mean
+//				"mean", rounded to a whole time, and reneges if still
+//				in line when it runs out. Every run draws from a
+//				stream seeded with "seed", so runs are repeatable. A
+//				mean of 0 (the default) makes customers wait as long
+//				as it takes.
+// Precondition: mean is not negative.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::setPatience(double mean, unsigned long long seed) {
+	meanPatience = mean;
+	patienceSeed = seed;
+}
+
+
+// Description: Makes customers balk at lines that already hold
+//				"lineLength" customers or more, or never if it is 0
+//				(the default).
+// Precondition: lineLength is not negative.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::setBalkingLimit(int lineLength) {
+	balkingLimit = lineLength;
+}
+
+
+// Description: Puts customers in priority classes: each arrival is
+//				class c with probability proportional to weights[c],
+//				and customers of a lower class are served before
+//				those of a higher one who are in the same line. Every
+//				run draws from a stream seeded with "seed". With one
+//				weight (the default) every customer is class 0 and
+//				nothing is drawn.
+// Precondition: weights has 1 to CUSTOMER_CLASS_COUNT elements, none
+//				 negative, with a positive sum.
+// Time Efficiency: O(CUSTOMER_CLASS_COUNT)
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::setClassMix(const vector<double>& weights, unsigned long long seed) {
+	classWeights = weights;
+	classSeed = seed;
+}
+
+
+// Description: Sets the patience, balking limit and class mix of
+//				"behavior" at once, all seeded with its seed, as
+//				setPatience(), setBalkingLimit() and setClassMix() do.
+// Precondition: As for those three.
+// Time Efficiency: O(CUSTOMER_CLASS_COUNT)
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::setBehavior(const CustomerBehavior& behavior) {
+	setPatience(behavior.meanPatience, behavior.seed);
+	setBalkingLimit(behavior.balkingLimit);
+	setClassMix(behavior.classWeights, behavior.seed);
+}
+
+
+// Description: Saves a checkpoint with "checkpoints" every "interval"
+//				events, or none if "checkpoints" is NULL (the
+//				default). Each checkpoint replaces the one before.
+// Precondition: interval is positive.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::setCheckpoints(Checkpointer* checkpoints, long long interval) {
+	checkpointer = checkpoints;
+	checkpointInterval = interval;
+}
+
+
+// Description: Processes every event in eventPriorityQueue, and any
+//				departures they lead to, in time order. The queue is
+//				moved into the simulation, not copied; pass a copy,
+//				run(EventQueue(queue)), to keep the original.
+// Precondition: eventPriorityQueue holds only arrival events.
+// Postcondition: eventPriorityQueue is empty.
+// Time Efficiency: O(n (log k + cost of the event queue))
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::run(EventQueue&& arrivals) {
+
+	EventQueue eventPriorityQueue(std::move(arrivals));	// Takes over the arrivals' storage
+
+	reset();
+
+	// Run simulation loop until the priority queue of events is empty
+	if (narration) {
+		narration->write("Simulation Begins");
+		narration->endLine();
+	}
+
+	processEvents(eventPriorityQueue);
+}
+
+
+// Description: Processes the arrivals read from "arrivals", which has a
+//				method bool next(Event&) returning "false" at the end,
+//				and the departures they lead to, in time order.
+//				Returns "false", having stopped early, if an arrival is
+//				earlier than the one before it.
+// Precondition: Arrivals are sorted by time.
+// Postcondition: Arrivals and departures at the same time are processed
+//				  in the same order as by run().
+// Time Efficiency: O(n (log k + cost of the event queue)), with the event
+//					queue holding at most k departures
+template <class EventQueue, class Observer>
+template <class ArrivalSource>
+bool BankSimulation<EventQueue, Observer>::runSorted(ArrivalSource& arrivals) {
+
+	EventQueue departures;		// Departures of the customers being served
+
+	reset();
+
+	if (narration) {
+		narration->write("Simulation Begins");
+		narration->endLine();
+	}
+
+	return processSorted(departures, arrivals);
+}
+
+
+// Description: Finishes the run() that saved "checkpoint", with the
+//				same final results as if it had not been stopped.
+//				Returns "false", having done nothing, if the
+//				checkpoint cannot be read or was taken by runSorted()
+//				or with other options; checkpoint.getError() says why.
+// Precondition: The options set are those of the run that saved it.
+// Time Efficiency: O(n (log k + cost of the event queue)) for the
+//					n events left
+template <class EventQueue, class Observer>
+bool BankSimulation<EventQueue, Observer>::resume(CheckpointReader& checkpoint) {
+
+	EventQueue eventPriorityQueue;
+
+	reset();
+
+	if (!readCheckpoint(checkpoint, eventPriorityQueue, false)) {
+		reset();
+		return false;
+	}
+
+	if (narration) {
+		narration->write("Simulation Resumes");
+		narration->endLine();
+	}
+
+	processEvents(eventPriorityQueue);
+	return true;
+}
+
+
+// Description: Finishes the runSorted() that saved "checkpoint", on
+//				the same arrivals, with the same final results as if
+//				it had not been stopped; the arrivals it had already
+//				processed are read and skipped. Returns "false" if the
+//				checkpoint cannot be used, as for resume(), or if
+//				"arrivals" runs out before the point it was taken or
+//				is not sorted.
+// Precondition: The options set are those of the run that saved it.
+// Time Efficiency: O(n (log k + cost of the event queue))
+template <class EventQueue, class Observer>
+template <class ArrivalSource>
+bool BankSimulation<EventQueue, Observer>::resumeSorted(CheckpointReader& checkpoint, ArrivalSource& arrivals) {
+
+	EventQueue departures;		// Departures of the customers being served
+	Event skipped;				// An arrival processed before the checkpoint
+
+	reset();
+
+	if (!readCheckpoint(checkpoint, departures, true)) {
+		reset();
+		return false;
+	}
+
+	for (long long i = 0; i < arrivalsProcessed; i++) {
+		if (!arrivals.next(skipped)) {
+			checkpoint.fail("the input ends before the point the checkpoint was taken");
+			reset();
+			return false;
+		}
+	}
+
+	if (narration) {
+		narration->write("Simulation Resumes");
+		narration->endLine();
+	}
+
+	return processSorted(departures, arrivals);
+}
+
+
+// Description: Returns the number of customers served by the last run.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+long long BankSimulation<EventQueue, Observer>::getCustomersProcessed() const {
+	return observers.first.getCustomersServed();
+}
+
+
+// Description: Returns the average time customers of the last run
+//				spent waiting in line.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+float BankSimulation<EventQueue, Observer>::getAverageWait() const {
+	return observers.first.getAverageWait();
+}
+
+
+// Description: Returns the number of departures of the last run
+//				that the event queue refused, such as a RadixHeap's
+//				for a time before 0, or whose time would pass INT_MAX;
+//				those customers never leave. A run is only valid if
+//				this is 0.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+long long BankSimulation<EventQueue, Observer>::getDeparturesRejected() const {
+	return departuresRejected;
+}
+
+
+// Description: Returns the statistics of the last run.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+const SimulationStatistics& BankSimulation<EventQueue, Observer>::getStatistics() const {
+	return observers.first;
+}
+
+
+// Description: Returns the custom observer, to set it up before a
+//				run or read what it gathered after.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+Observer& BankSimulation<EventQueue, Observer>::getObserver() {
+	return observers.second;
+}
+
+
+template <class EventQueue, class Observer>
+const Observer& BankSimulation<EventQueue, Observer>::getObserver() const {
+	return observers.second;
+}
+
+
+// Description: Narrates "event" if narration is on.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::narrate(const Event& event) {
+
+	if (!narration)
+		return;
+
+	if (event.getType() == ARRIVAL)
+		narration->write("Processing an arrival event at time:\t");
+	else
+		narration->write("Processing a departure event at time:\t");
+
+	narration->write(event.getTime(), 3);
+	narration->endLine();
+}
+
+
+// Description: Resets the tellers, lines and totals for a new run.
+// Time Efficiency: O(k log k)
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::reset() {
+
+	sharedLine = Line();
+	idleTellers = HeapPriorityQueue<int>();
+	tellerLines.clear();
+	tellerLoads.clear();
+	tellersByLoad.clear();
+	deadlines = IndexedHeapPriorityQueue<PatienceDeadline>();
+	eventsProcessed = 0;
+	arrivalsProcessed = 0;
+	departuresRejected = 0;
+	patienceEngine.seed(patienceSeed);
+
+	// The class stream is seeded apart from the patience stream, so that
+	// the same --seed does not give both the same draws
+	seed_seq classSeeds = { (unsigned int)classSeed, (unsigned int)(classSeed >> 32), 1u };
+	classEngine.seed(classSeeds);
+	classDistribution = discrete_distribution<int>(classWeights.begin(), classWeights.end());
+
+	// Every teller starts idle with no customers
+	if (linePolicy == SHARED_LINE) {
+		for (int teller = 0; teller < tellerCount; teller++)
+			idleTellers.enqueue(teller);
+	}
+	else {
+		tellerLines.resize(tellerCount);
+		tellerLoads.assign(tellerCount, 0);
+		for (int teller = 0; teller < tellerCount; teller++)
+			tellersByLoad.insert(make_pair(0, teller));
+	}
+
+	observers.reset(tellerCount);
+}
+
+
+// Description: Returns the line customers of "teller" wait in.
+// Time Efficiency: O(1)
+template <class EventQueue, class Observer>
+typename BankSimulation<EventQueue, Observer>::Line& BankSimulation<EventQueue, Observer>::lineOf(int teller) {
+	return (linePolicy == SHARED_LINE) ? sharedLine : tellerLines[teller];
+}
+
+
+// Description: Sends an arriving customer to a teller or a line, or
+//				away if they balk.
+// Time Efficiency: O(log k + log w) for w customers waiting, plus
+//					one event queue enqueue
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::processArrival(EventQueue& eventPriorityQueue, const Event& arrival) {
+
+	Event customer = arrival;
+	int patience = 0;
+
+	// With a class mix, each arrival is given its class as it comes in
+	if (classWeights.size() > 1)
+		customer.setCustomerClass(classDistribution(classEngine));
+	observers.customerArrived(customer);
+
+	// Every arrival draws a patience, whether or not they wait, so the
+	// customers of a trace have the same patience under either line policy
+	if (meanPatience > 0.0) {
+		exponential_distribution<double> patienceDistribution(1.0 / meanPatience);
+		patience = (int)(patienceDistribution(patienceEngine) + 0.5);
+	}
+
+	if (linePolicy == SHARED_LINE) {
+		// If the line is empty and a teller is idle, the arriving customer goes
+		// straight to the lowest-numbered idle teller without waiting;
+		// otherwise they join the back of the line, unless it is too long
+		if (sharedLine.isEmpty() && !idleTellers.isEmpty()) {
+			int teller = idleTellers.peek();
+			idleTellers.dequeue();
+			startService(eventPriorityQueue, customer, teller, customer.getTime());
+		}
+		else if (balkingLimit > 0 && sharedLine.getElementCount() >= balkingLimit)
+			observers.customerBalked(customer);
+		else
+			joinLine(0, customer, patience);
+	}
+	else {
+		// Join the teller with the fewest customers; if it has none, the
+		// teller is idle and serves the customer at once
+		int teller = tellersByLoad.begin()->second;
+		bool tellerIdle = tellerLoads[teller] == 0;
+
+		if (!tellerIdle && balkingLimit > 0 && tellerLines[teller].getElementCount() >= balkingLimit) {
+			observers.customerBalked(customer);
+			return;
+		}
+
+		changeLoad(teller, 1);
+
+		if (tellerIdle)
+			startService(eventPriorityQueue, customer, teller, customer.getTime());
+		else
+			joinLine(teller, customer, patience);
+	}
+}
+
+
+// Description: Adds "customer" to the back of the line of "teller",
+//				with a deadline "patience" after their arrival if
+//				customers are impatient.
+// Time Efficiency: O(log w) for w customers waiting
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::joinLine(int teller, const Event& customer, int patience) {
+
+	Line& line = lineOf(teller);
+	WaitingCustomer waiting = { customer, NO_DEADLINE };
+	int position = line.enqueue(waiting, customer.getCustomerClass());
+
+	observers.lineLengthChanged(teller, line.getElementCount() - 1, line.getElementCount());
+
+	if (meanPatience > 0.0) {
+		PatienceDeadline deadline = { customer.getTime() + patience, teller, position };
+		line.get(position).deadline = deadlines.enqueue(deadline);
+	}
+}
+
+
+// Description: Frees the departing customer's teller, who serves the
+//				next customer in line or becomes idle.
+// Time Efficiency: O(log k + log w) for w customers waiting, plus
+//					one event queue enqueue
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::processDeparture(EventQueue& eventPriorityQueue, const Event& departure) {
+
+	int teller = departure.getTeller();
+	Line& line = lineOf(teller);
+
+	observers.customerDeparted(departure);
+	if (linePolicy == TELLER_LINES)
+		changeLoad(teller, -1);
+
+	// If there are customers in line, the front customer can now begin
+	// their transaction, and will no longer renege
+	if (!line.isEmpty()) {
+		WaitingCustomer nextCustomer = line.peek();
+		line.dequeue();
+		if (nextCustomer.deadline != NO_DEADLINE)
+			deadlines.cancel(nextCustomer.deadline);
+
+		observers.lineLengthChanged((linePolicy == SHARED_LINE) ? 0 : teller, line.getElementCount() + 1,
+			line.getElementCount());
+		startService(eventPriorityQueue, nextCustomer.customer, teller, departure.getTime());
+	}
+	else if (linePolicy == SHARED_LINE) {
+		// If there are no customers in line, then teller is available
+		idleTellers.enqueue(teller);
+	}
+}
+
+
+// Description: Removes from their lines the customers whose patience
+//				ran out before "time". A customer whose patience runs
+//				out at the same time as a teller frees up is served.
+// Time Efficiency: O(log k + log w) per customer removed, for w
+//					customers waiting
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::processReneging(int time) {
+
+	while (!deadlines.isEmpty() && deadlines.peek().time < time) {
+		PatienceDeadline deadline = deadlines.peek();
+		deadlines.dequeue();
+
+		Line& line = lineOf(deadline.line);
+		Event customer = line.get(deadline.position).customer;
+
+		observers.advanceTo(deadline.time);
+		line.remove(deadline.position);
+		observers.lineLengthChanged(deadline.line, line.getElementCount() + 1, line.getElementCount());
+		observers.customerReneged(customer);
+		if (linePolicy == TELLER_LINES)
+			changeLoad(deadline.line, -1);
+
+		if (narration) {
+			narration->write("A customer leaves the line at time:\t");
+			narration->write(deadline.time, 3);
+			narration->endLine();
+		}
+	}
+}
+
+
+// Description: Starts serving "customer" at "teller" at currentTime and
+//				schedules the departure. Their time spent waiting is
+//				added to the statistics.
+// Time Efficiency: One event queue enqueue
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::startService(EventQueue& eventPriorityQueue, const Event& customer,
+	int teller, int currentTime) {
+
+	// A departure whose time does not fit in an int is rejected like one
+	// the event queue refuses
+	long long departureTime = (long long)currentTime + customer.getLength();
+	if (departureTime < INT_MIN || departureTime > INT_MAX
+		|| !eventPriorityQueue.enqueue(Event(DEPARTURE, (int)departureTime, customer.getLength(), teller)))
+		departuresRejected++;
+	observers.serviceStarted(customer, teller, currentTime);
+
+	if (customerLog) {
+		int row[CUSTOMER_LOG_COLUMN_COUNT] = { customer.getTime(), currentTime, customer.getLength(), teller };
+		customerLog->append(row);
+	}
+}
+
+
+// Description: Changes the number of customers at "teller" by "change".
+// Precondition: linePolicy is TELLER_LINES.
+// Time Efficiency: O(log k)
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::changeLoad(int teller, int change) {
+
+	tellersByLoad.erase(make_pair(tellerLoads[teller], teller));
+	tellerLoads[teller] += change;
+	tellersByLoad.insert(make_pair(tellerLoads[teller], teller));
+}
+
+
+// Description: Processes every event in eventPriorityQueue, and any
+//				departures they lead to, in time order.
+// Time Efficiency: O(n (log k + cost of the event queue))
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::processEvents(EventQueue& eventPriorityQueue) {
+
+	Event currentEvent;			// Event at front of priority queue
+
+	while (!eventPriorityQueue.isEmpty()) {
+
+		// Get current event from front of priority queue
+		try {
+			currentEvent = eventPriorityQueue.peek();
+		}
+		catch (EmptyDataCollectionException &anException) {
+			cout << "Simulation unsuccessful because " << anException.what() << endl;
+		}
+
+		// Remove event from priority queue and process it according to
+		// whether it is an arrival or departure
+		eventPriorityQueue.dequeue();
+		processReneging(currentEvent.getTime());
+		narrate(currentEvent);
+		observers.advanceTo(currentEvent.getTime());
+
+		if (currentEvent.getType() == ARRIVAL)
+			processArrival(eventPriorityQueue, currentEvent);
+		else
+			processDeparture(eventPriorityQueue, currentEvent);
+
+		countEvent(eventPriorityQueue, false);
+	} // end while
+
+	if (narration) {
+		narration->write("Simulation Ends");
+		narration->endLine();
+	}
+}
+
+
+// Description: Processes the arrivals read from "arrivals" and the
+//				departures in "departures", in time order, and
+//				returns "false" if an arrival is earlier than the one
+//				before it.
+// Time Efficiency: O(n (log k + cost of the event queue))
+template <class EventQueue, class Observer>
+template <class ArrivalSource>
+bool BankSimulation<EventQueue, Observer>::processSorted(EventQueue& departures, ArrivalSource& arrivals) {
+
+	Event arrival;				// Next arrival not yet processed
+	bool arrivalPending;		// Whether "arrival" holds an arrival
+	bool sorted = true;			// Whether arrivals have been in time order
+
+	arrivalPending = arrivals.next(arrival);
+
+	while (arrivalPending || !departures.isEmpty()) {
+
+		// run() queues every arrival before any departure is scheduled, so an
+		// arrival goes first when it ties with a departure
+		if (arrivalPending && (departures.isEmpty() || arrival.getTime() <= departures.peek().getTime())) {
+			int arrivalTime = arrival.getTime();
+
+			processReneging(arrivalTime);
+			narrate(arrival);
+			observers.advanceTo(arrivalTime);
+			processArrival(departures, arrival);
+			arrivalsProcessed++;
+			countEvent(departures, true);
+
+			arrivalPending = arrivals.next(arrival);
+			if (arrivalPending && arrival.getTime() < arrivalTime) {
+				sorted = false;
+				break;
+			}
+		}
+		else {
+			Event departure = departures.peek();
+			departures.dequeue();
+
+			processReneging(departure.getTime());
+			narrate(departure);
+			observers.advanceTo(departure.getTime());
+			processDeparture(departures, departure);
+			countEvent(departures, true);
+		}
+	} // end while
+
+	if (narration && sorted) {
+		narration->write("Simulation Ends");
+		narration->endLine();
+	}
+
+	return sorted;
+}
+
+
+// Description: Counts an event as processed, and every
+//				checkpointInterval events hands a copy of the state
+//				and of "events" to the checkpointer, unless it is still
+//				saving the last one.
+// Time Efficiency: O(1), or O(state) to take a copy
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::countEvent(const EventQueue& events, bool streaming) {
+
+	eventsProcessed++;
+
+	if (!checkpointer || eventsProcessed % checkpointInterval != 0)
+		return;
+
+	// The run never waits for a checkpoint; if the last one is still being
+	// saved, this one is skipped and the next interval tries again
+	if (checkpointer->isSaving())
+		return;
+
+	// Only the copies are taken here; encoding them is left to the
+	// checkpointer's thread, so the run pauses as little as it can
+	shared_ptr< BankSimulation<EventQueue, Observer> > state(new BankSimulation<EventQueue, Observer>(*this));
+	shared_ptr<EventQueue> queued(new EventQueue(events));
+
+	checkpointer->write([state, queued, streaming](CheckpointWriter& checkpoint) {
+		state->writeCheckpoint(checkpoint, *queued, streaming);
+	});
+}
+
+
+// Description: Writes the state of the run, with the elements of
+//				"events" and their ranks, to "checkpoint".
+// Time Efficiency: O(n + c log c) for n events and c customers waiting
+template <class EventQueue, class Observer>
+void BankSimulation<EventQueue, Observer>::writeCheckpoint(CheckpointWriter& checkpoint, const EventQueue& events,
+	bool streaming) const {
+
+	ostringstream patienceState;
+	ostringstream classState;
+
+	// The options of the run, which the resumed run must share
+	checkpoint.writeInt(streaming);
+	checkpoint.writeInt(tellerCount);
+	checkpoint.writeInt(linePolicy);
+	checkpoint.writeDouble(meanPatience);
+	checkpoint.writeUnsigned(patienceSeed);
+	checkpoint.writeInt(balkingLimit);
+	checkpoint.writeInt(classWeights.size());
+	for (size_t i = 0; i < classWeights.size(); i++)
+		checkpoint.writeDouble(classWeights[i]);
+	checkpoint.writeUnsigned(classSeed);
+
+	// Progress, random streams and statistics
+	checkpoint.writeInt(eventsProcessed);
+	checkpoint.writeInt(arrivalsProcessed);
+	patienceState << patienceEngine;
+	classState << classEngine;
+	checkpoint.writeString(patienceState.str());
+	checkpoint.writeString(classState.str());
+	observers.first.writeCheckpoint(checkpoint);
+
+	// Tellers
+	HeapPriorityQueue<int> idle(idleTellers);
+	checkpoint.writeInt(idle.getElementCount());
+	for (; !idle.isEmpty(); idle.dequeue())
+		checkpoint.writeInt(idle.peek());
+
+	checkpoint.writeInt(tellerLoads.size());
+	for (size_t i = 0; i < tellerLoads.size(); i++)
+		checkpoint.writeInt(tellerLoads[i]);
+
+	// Patience deadlines in the order they would run out, as time gaps; the
+	// customers in line refer to them by this order
+	IndexedHeapPriorityQueue<PatienceDeadline> pending(deadlines);
+	map<int, int> orderOf;		// Order of each deadline, by handle
+	int previousTime = 0;
+
+	checkpoint.writeInt(pending.getElementCount());
+	for (int order = 0; !pending.isEmpty(); order++) {
+		orderOf[pending.peekHandle()] = order;
+		checkpoint.writeInt((long long)pending.peek().time - previousTime);
+		previousTime = pending.peek().time;
+		pending.dequeue();
+	}
+
+	// Lines, each in the order its customers would be served
+	int lineCount = (linePolicy == SHARED_LINE) ? 1 : tellerCount;
+
+	checkpoint.writeInt(lineCount);
+	for (int teller = 0; teller < lineCount; teller++) {
+		Line line((linePolicy == SHARED_LINE) ? sharedLine : tellerLines[teller]);
+
+		checkpoint.writeInt(line.getElementCount());
+		for (; !line.isEmpty(); line.dequeue()) {
+			WaitingCustomer waiting = line.peek();
+
+			checkpoint.writeInt(waiting.customer.getTime());
+			checkpoint.writeInt(waiting.customer.getLength());
+			checkpoint.writeInt(waiting.customer.getCustomerClass());
+			checkpoint.writeInt(waiting.deadline == NO_DEADLINE ? -1 : orderOf[waiting.deadline]);
+		}
+	}
+
+	// Events in the order the queue holds them, each with its rank; time
+	// and rank are written as gaps from the event before, which keeps them
+	// short in a queue that is sorted or nearly so
+	long long previousRank = 0;
+
+	previousTime = 0;
+	checkpoint.writeInt(events.getElementCount());
+	events.forEachEntry([&checkpoint, &previousTime, &previousRank](const Event& event, unsigned long long rank) {
+		checkpoint.writeInt(event.getType());
+		checkpoint.writeInt((long long)event.getTime() - previousTime);
+		checkpoint.writeInt(event.getLength());
+		checkpoint.writeInt(event.getTeller());
+		checkpoint.writeInt(event.getCustomerClass());
+		checkpoint.writeInt((long long)rank - previousRank);
+		previousTime = event.getTime();
+		previousRank = rank;
+	});
+}
+
+
+// Description: Replaces the state of the run, after reset(), and
+//				"events" with those in "checkpoint", and returns
+//				"false" if it cannot be read, was taken by the other
+//				kind of run or with other options.
+// Time Efficiency: O(n log n) for n events and customers waiting
+template <class EventQueue, class Observer>
+bool BankSimulation<EventQueue, Observer>::readCheckpoint(CheckpointReader& checkpoint, EventQueue& events,
+	bool streaming) {
+
+	// The options of the run must match this simulation's
+	if (checkpoint.readInt() != streaming) {
+		checkpoint.fail(streaming ? "checkpoint was not taken with --stream" : "checkpoint was taken with --stream");
+		return false;
+	}
+
+	bool sameOptions = checkpoint.readInt() == tellerCount;
+	sameOptions = checkpoint.readInt() == linePolicy && sameOptions;
+	sameOptions = checkpoint.readDouble() == meanPatience && sameOptions;
+	sameOptions = checkpoint.readUnsigned() == patienceSeed && sameOptions;
+	sameOptions = checkpoint.readInt() == balkingLimit && sameOptions;
+	sameOptions = checkpoint.readInt() == (long long)classWeights.size() && sameOptions;
+	for (size_t i = 0; sameOptions && i < classWeights.size(); i++)
+		sameOptions = checkpoint.readDouble() == classWeights[i];
+	sameOptions = checkpoint.readUnsigned() == classSeed && sameOptions;
+
+	if (!sameOptions)
+		checkpoint.fail("checkpoint was taken with other options");
+	if (checkpoint.hasFailed())
+		return false;
+
+	// Progress, random streams and statistics
+	istringstream patienceState;
+	istringstream classState;
+
+	eventsProcessed = checkpoint.readInt();
+	arrivalsProcessed = checkpoint.readInt();
+	patienceState.str(checkpoint.readString());
+	classState.str(checkpoint.readString());
+	patienceState >> patienceEngine;
+	classState >> classEngine;
+	if (!patienceState || !classState)
+		checkpoint.fail("checkpoint has an unreadable random stream");
+	observers.first.readCheckpoint(checkpoint);
+
+	// Tellers
+	int idleCount = checkpoint.readCount(linePolicy == SHARED_LINE ? tellerCount : 0);
+	idleTellers = HeapPriorityQueue<int>();
+	for (int i = 0; i < idleCount; i++) {
+		int teller = checkpoint.readInt();
+		if (teller < 0 || teller >= tellerCount)
+			checkpoint.fail("checkpoint has a teller out of range");
+		idleTellers.enqueue(teller);
+	}
+
+	if (checkpoint.readCount(tellerCount) != (int)tellerLoads.size())
+		checkpoint.fail("checkpoint has the wrong number of tellers");
+	tellersByLoad.clear();
+	for (int teller = 0; teller < (int)tellerLoads.size(); teller++) {
+		tellerLoads[teller] = checkpoint.readInt();
+		tellersByLoad.insert(make_pair(tellerLoads[teller], teller));
+	}
+
+	// Patience deadlines, in order; where their customers wait is filled in
+	// from the lines
+	int deadlineCount = checkpoint.readCount(INT_MAX);
+	vector<PatienceDeadline> pending;
+	long long previousTime = 0;
+
+	for (int i = 0; i < deadlineCount && !checkpoint.hasFailed(); i++) {
+		long long time = previousTime + checkpoint.readInt();
+
+		if (time < INT_MIN || time > INT_MAX) {
+			checkpoint.fail("checkpoint has a deadline out of range");
+			break;
+		}
+		PatienceDeadline deadline = { (int)time, -1, -1 };
+		pending.push_back(deadline);
+		previousTime = time;
+	}
+
+	// Lines
+	int lineCount = checkpoint.readCount(tellerCount);
+	if (lineCount != ((linePolicy == SHARED_LINE) ? 1 : tellerCount))
+		checkpoint.fail("checkpoint has the wrong number of lines");
+
+	for (int teller = 0; teller < lineCount && !checkpoint.hasFailed(); teller++) {
+		Line& line = lineOf(teller);
+		int customers = checkpoint.readCount(INT_MAX);
+
+		for (int i = 0; i < customers && !checkpoint.hasFailed(); i++) {
+			// Any time and length a run accepts, such as 0, is valid, so the
+			// customer is built directly rather than with Event's setters
+			long long time = checkpoint.readInt();
+			long long length = checkpoint.readInt();
+			WaitingCustomer waiting = { Event(ARRIVAL, (int)time, (int)length), NO_DEADLINE };
+			bool valid = time >= INT_MIN && time <= INT_MAX && length >= INT_MIN && length <= INT_MAX;
+
+			valid = waiting.customer.setCustomerClass(checkpoint.readInt()) && valid;
+
+			int order = checkpoint.readInt();
+			if (!valid || order < -1 || order >= (int)pending.size() || (order >= 0 && pending[order].line != -1)) {
+				checkpoint.fail("checkpoint has an invalid customer in line");
+				break;
+			}
+
+			int position = line.enqueue(waiting, waiting.customer.getCustomerClass());
+			if (order >= 0) {
+				pending[order].line = teller;
+				pending[order].position = position;
+			}
+		}
+	}
+
+	// Enqueued in order, so equal deadlines keep their order
+	deadlines = IndexedHeapPriorityQueue<PatienceDeadline>();
+	for (size_t i = 0; i < pending.size() && !checkpoint.hasFailed(); i++) {
+		if (pending[i].line == -1) {
+			checkpoint.fail("checkpoint has a deadline with no customer");
+			break;
+		}
+		lineOf(pending[i].line).get(pending[i].position).deadline = deadlines.enqueue(pending[i]);
+	}
+
+	// Events, with their ranks
+	int eventCount = checkpoint.readCount(INT_MAX);
+	vector< pair<long long, Event> > ranked;
+	long long previousRank = 0;
+
+	previousTime = 0;
+	for (int i = 0; i < eventCount && !checkpoint.hasFailed(); i++) {
+		long long type = checkpoint.readInt();
+		long long time = previousTime + checkpoint.readInt();
+		long long length = checkpoint.readInt();
+		long long teller = checkpoint.readInt();
+		bool valid = (type == ARRIVAL || type == DEPARTURE) && time >= INT_MIN && time <= INT_MAX
+			&& length >= INT_MIN && length <= INT_MAX && teller >= 0 && teller < tellerCount;
+
+		// As for customers in line, built directly so times of 0 are kept
+		Event event(valid ? (EventType)type : ARRIVAL, (int)time, (int)length, valid ? (int)teller : 0);
+
+		valid = event.setCustomerClass(checkpoint.readInt()) && valid;
+		if (!valid) {
+			checkpoint.fail("checkpoint has an invalid event");
+			break;
+		}
+
+		previousRank += checkpoint.readInt();
+		ranked.push_back(make_pair(previousRank, event));
+		previousTime = time;
+	}
+
+	if (!checkpoint.hasFailed() && !checkpoint.isAtEnd())
+		checkpoint.fail("checkpoint has data after its end");
+	if (checkpoint.hasFailed())
+		return false;
+
+	// Enqueued in rank order, so equal events keep the order they leave in
+	auto lowerRank = [](const pair<long long, Event>& lhs, const pair<long long, Event>& rhs) {
+		return lhs.first < rhs.first;
+	};
+	vector<Event> queued;
+
+	stable_sort(ranked.begin(), ranked.end(), lowerRank);
+	for (size_t i = 0; i < ranked.size(); i++)
+		queued.push_back(ranked[i].second);
+
+	events = EventQueue(queued.begin(), queued.end());
+	return true;
+}
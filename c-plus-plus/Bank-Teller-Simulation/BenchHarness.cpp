@@ -0,0 +1,124 @@
+/*
+* BenchHarness.cpp
+*
+* Class Description: Shared by the benchmark programs: an operator new that
+*					 counts allocations, a timer, and CSV output of cases
+*					 run in child processes.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "BenchHarness.h"
+
+using namespace std;
+
+
+// Number of calls to operator new since the program started
+long long allocationCount = 0;
+
+// Number of benchmark cases whose process failed
+int failedBenchCases = 0;
+
+
+// Count every allocation made through operator new
+void* operator new(size_t size) {
+
+	allocationCount++;
+
+	void* memory = malloc(size ? size : 1);
+	if (!memory)
+		throw bad_alloc();
+
+	return memory;
+}
+
+void operator delete(void* memory) noexcept {
+	free(memory);
+}
+
+
+// Constructor; starts the timer
+BenchTimer::BenchTimer() {
+	startAllocations = allocationCount;
+	start = chrono::steady_clock::now();
+}
+
+
+// Description: Records the time and allocations since the timer
+//				started in "result".
+// Time Efficiency: O(1)
+void BenchTimer::stop(BenchResult& result) const {
+
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+	result.seconds = elapsed.count();
+	result.allocations = allocationCount - startAllocations;
+}
+
+
+// Description: Prints the header of the CSV output.
+void printBenchHeader() {
+	cout << "suite,implementation,workload,n,operations,seconds,ns_per_op,ops_per_second,"
+		<< "peak_rss_kb,allocations" << endl;
+}
+
+
+// Description: Prints the CSV row for "result", with the process's peak
+//				resident set size.
+void printBenchRow(const BenchResult& result) {
+
+	struct rusage usage;
+	char row[512];
+
+	getrusage(RUSAGE_SELF, &usage);
+
+	snprintf(row, sizeof(row), "%s,%s,%s,%lld,%lld,%.6f,%.2f,%.0f,%ld,%lld",
+		result.suite.c_str(), result.implementation.c_str(), result.workload.c_str(),
+		result.n, result.operations, result.seconds, result.seconds * 1e9 / result.operations,
+		result.operations / result.seconds, usage.ru_maxrss, result.allocations);
+
+	cout << row << endl;
+}
+
+
+// Description: Forks; returns "true" in the child, and in the parent
+//				waits for the child and returns "false".
+bool forkBenchCase() {
+
+	// Anything buffered would otherwise be printed by both processes
+	cout.flush();
+
+	pid_t child = fork();
+
+	if (child == 0)
+		return true;
+
+	if (child < 0) {
+		cerr << "Cannot fork a benchmark case" << endl;
+		failedBenchCases++;
+	}
+	else {
+		int status;
+		waitpid(child, &status, 0);
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+			cerr << "A benchmark case failed" << endl;
+			failedBenchCases++;
+		}
+	}
+
+	return false;
+}
+
+
+// Description: Ends the child process after its case.
+void endBenchCase() {
+	cout.flush();
+	_exit(0);
+}
@@ -0,0 +1,89 @@
+/*
+* BenchHarness.h
+*
+* Class Description: Shared by the benchmark programs (queueBench and
+*					 simulationBench). Every benchmark case runs in a forked
+*					 child process, so that the peak resident set size
+*					 reported for it is its own and not that of an earlier,
+*					 larger case, and prints one CSV row:
+*					 suite,implementation,workload,n,operations,seconds,
+*					 ns_per_op,ops_per_second,peak_rss_kb,allocations
+*					 "allocations" counts calls to operator new, which this
+*					 harness replaces, during the timed part of the case.
+*					 A case that exits with an error is counted in
+*					 failedBenchCases, and the programs then fail too.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <string>
+#include <chrono>
+
+using namespace std;
+
+// Number of calls to operator new since the program started
+extern long long allocationCount;
+
+// Number of benchmark cases whose process failed
+extern int failedBenchCases;
+
+// What a benchmark case measured
+struct BenchResult {
+	string suite;				// Which benchmark program ran the case
+	string implementation;		// Data structure or configuration benchmarked
+	string workload;			// What was done with it
+	long long n;				// Size of the case: elements or customers
+	long long operations;		// Operations or events timed
+	double seconds;				// Time taken by the operations
+	long long allocations;		// Calls to operator new made by the operations
+};
+
+// Times a part of a benchmark case, and counts its allocations
+class BenchTimer {
+
+	private:
+		chrono::steady_clock::time_point start;		// When the timer was started
+		long long startAllocations;					// allocationCount when started
+
+	public:
+		// Constructor; starts the timer
+		BenchTimer();
+
+		// Description: Records the time and allocations since the timer
+		//				started in "result".
+		// Time Efficiency: O(1)
+		void stop(BenchResult& result) const;
+
+}; // end BenchTimer
+
+// Description: Prints the header of the CSV output.
+void printBenchHeader();
+
+// Description: Runs "benchmarkCase", a function returning a BenchResult,
+//				in a child process and prints its CSV row.
+template <class BenchmarkCase>
+void runIsolated(BenchmarkCase benchmarkCase);
+
+// Description: Prints the CSV row for "result", with the process's peak
+//				resident set size.
+void printBenchRow(const BenchResult& result);
+
+// Description: Forks; returns "true" in the child, and in the parent
+//				waits for the child and returns "false".
+bool forkBenchCase();
+
+// Description: Ends the child process after its case.
+void endBenchCase();
+
+
+// Description: Runs "benchmarkCase", a function returning a BenchResult,
+//				in a child process and prints its CSV row.
+template <class BenchmarkCase>
+void runIsolated(BenchmarkCase benchmarkCase) {
+
+	if (forkBenchCase()) {
+		printBenchRow(benchmarkCase());
+		endBenchCase();
+	}
+}
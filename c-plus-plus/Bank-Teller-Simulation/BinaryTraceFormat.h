@@ -0,0 +1,115 @@
+/*
+* BinaryTraceFormat.h
+*
+* Description: Constants and encoding helpers shared by BinaryTraceReader
+*			   and BinaryTraceWriter.
+*
+*			   A binary trace is a table of int columns, such as arrival
+*			   times and transaction lengths, stored as follows (all fixed
+*			   width fields little-endian):
+*
+*			   Header: "BTRC", u16 version, u16 column count, then for each
+*					   column a u8 column id and a u8 encoding, then a u32
+*					   checksum of the header bytes before it.
+*			   Blocks: u32 row count (at most TRACE_BLOCK_ROWS), u32 payload
+*					   length, u32 checksum of the payload, then the payload:
+*					   each column in turn, as one varint per row.
+*			   End:    u32 row count of 0, then u64 total row count.
+*
+*			   Values are zigzag-encoded, so small negative numbers stay
+*			   short. A DELTA_VARINT column stores each value minus the one
+*			   before it in the block, so sorted arrival times take about a
+*			   byte each. Each block decodes on its own, and a reader or
+*			   writer only ever holds one block in memory.
+*			   Checksums are 32-bit FNV-1a.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+const unsigned char TRACE_MAGIC[4] = { 'B', 'T', 'R', 'C' };
+const int TRACE_VERSION = 1;
+const int TRACE_BLOCK_ROWS = 65536;		// Rows in every block but the last
+
+// What a column holds
+enum TraceColumn : unsigned char {
+	ARRIVAL_TIME_COLUMN = 1,
+	TRANSACTION_LENGTH_COLUMN = 2,
+	SERVICE_START_COLUMN = 3,
+	TELLER_COLUMN = 4
+};
+
+// How a column's values are stored
+enum ColumnEncoding : unsigned char {
+	VARINT_ENCODING = 0,		// Each value, zigzag varint
+	DELTA_VARINT_ENCODING = 1	// Difference from the previous value, zigzag varint
+};
+
+// A column of a trace
+struct ColumnSpec {
+	TraceColumn column;
+	ColumnEncoding encoding;
+};
+
+// Columns of an arrival trace, the binary form of a .in file
+const ColumnSpec ARRIVAL_TRACE_COLUMNS[] = {
+	{ ARRIVAL_TIME_COLUMN, DELTA_VARINT_ENCODING },
+	{ TRANSACTION_LENGTH_COLUMN, VARINT_ENCODING }
+};
+const int ARRIVAL_TRACE_COLUMN_COUNT = 2;
+
+// Columns of the per-customer log written by the simulation, one row per
+// customer in the order their service starts
+const ColumnSpec CUSTOMER_LOG_COLUMNS[] = {
+	{ ARRIVAL_TIME_COLUMN, DELTA_VARINT_ENCODING },
+	{ SERVICE_START_COLUMN, DELTA_VARINT_ENCODING },
+	{ TRANSACTION_LENGTH_COLUMN, VARINT_ENCODING },
+	{ TELLER_COLUMN, VARINT_ENCODING }
+};
+const int CUSTOMER_LOG_COLUMN_COUNT = 4;
+
+
+// Description: Maps a signed value to an unsigned one, small magnitudes first.
+// Time Efficiency: O(1)
+inline unsigned int zigzagEncode(int value) {
+	return ((unsigned int)value << 1) ^ (unsigned int)(value >> 31);
+}
+
+
+// Description: Inverse of zigzagEncode.
+// Time Efficiency: O(1)
+inline int zigzagDecode(unsigned int value) {
+	return (int)((value >> 1) ^ (0u - (value & 1)));
+}
+
+
+// Description: Appends "value" to "bytes" as a little-endian base-128 varint.
+// Time Efficiency: O(1)
+inline void appendVarint(vector<unsigned char>& bytes, unsigned int value) {
+
+	while (value >= 0x80) {
+		bytes.push_back((unsigned char)(value | 0x80));
+		value >>= 7;
+	}
+	bytes.push_back((unsigned char)value);
+}
+
+
+// Description: Returns the 32-bit FNV-1a checksum of "length" bytes.
+// Time Efficiency: O(length)
+inline unsigned int traceChecksum(const unsigned char* bytes, size_t length) {
+
+	unsigned int checksum = 2166136261u;
+
+	for (size_t i = 0; i < length; i++) {
+		checksum ^= bytes[i];
+		checksum *= 16777619u;
+	}
+
+	return checksum;
+}
@@ -0,0 +1,346 @@
+/*
+* BinaryTraceReader.cpp
+*
+* Class Description: Reads a binary trace (see BinaryTraceFormat.h) from a
+*					 file descriptor, one block at a time.
+* Class Invariant: blockColumns holds the decoded rows of the current block;
+*				   rows before blockPosition have been returned.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include "BinaryTraceReader.h"
+
+using namespace std;
+
+
+// Description: Returns "width" little-endian bytes as a number.
+// Time Efficiency: O(width)
+static unsigned long long decodeFixed(const unsigned char* bytes, int width) {
+
+	unsigned long long value = 0;
+
+	for (int i = width - 1; i >= 0; i--)
+		value = (value << 8) | bytes[i];
+
+	return value;
+}
+
+
+// Constructor; reads the header from standard input by default
+BinaryTraceReader::BinaryTraceReader(int traceFileDescriptor) {
+
+	fileDescriptor = traceFileDescriptor;
+	blockRows = 0;
+	blockPosition = 0;
+	totalRows = 0;
+	ended = false;
+	arrivalColumn = -1;
+	lengthColumn = -1;
+
+	readHeader();
+}
+
+
+// Description: Returns "true" if the trace could not be read, for
+//				example because it is truncated or a checksum is wrong.
+// Time Efficiency: O(1)
+bool BinaryTraceReader::hasFailed() const {
+	return !error.empty();
+}
+
+
+// Description: Returns why reading failed, or an empty string.
+// Time Efficiency: O(1)
+const string& BinaryTraceReader::getError() const {
+	return error;
+}
+
+
+// Description: Returns the number of columns in the trace.
+// Time Efficiency: O(1)
+int BinaryTraceReader::getColumnCount() const {
+	return columns.size();
+}
+
+
+// Description: Returns the spec of column "index".
+// Precondition: index is less than getColumnCount().
+// Time Efficiency: O(1)
+ColumnSpec BinaryTraceReader::getColumn(int index) const {
+	return columns[index];
+}
+
+
+// Description: Reads up to "capacity" rows into "rows", one value per
+//				column for each row, and returns how many were read,
+//				or 0 at the end of the trace.
+// Time Efficiency: O(values read) amortized
+int BinaryTraceReader::readRows(int* rows, int capacity) {
+
+	int count = 0;
+	int columnCount = columns.size();
+
+	while (count < capacity && hasRow()) {
+		for (int i = 0; i < columnCount; i++)
+			rows[count * columnCount + i] = blockColumns[i][blockPosition];
+
+		blockPosition++;
+		count++;
+	}
+
+	return count;
+}
+
+
+// Description: Reads up to "capacity" arrivals into "arrivals" and
+//				returns how many were read, or 0 at the end of the trace.
+// Precondition: The trace has arrival time and transaction length columns.
+// Time Efficiency: O(arrivals read) amortized
+int BinaryTraceReader::readBatch(Event* arrivals, int capacity) {
+
+	int count = 0;
+
+	if (arrivalColumn < 0 || lengthColumn < 0) {
+		fail("binary trace has no arrival time and transaction length columns");
+		return 0;
+	}
+
+	// Copy whole runs of the current block at a time
+	while (count < capacity && hasRow()) {
+		const int* times = &blockColumns[arrivalColumn][0];
+		const int* lengths = &blockColumns[lengthColumn][0];
+		int run = blockRows - blockPosition;
+
+		if (run > capacity - count)
+			run = capacity - count;
+
+		for (int i = 0; i < run; i++)
+			arrivals[count + i] = Event(ARRIVAL, times[blockPosition + i], lengths[blockPosition + i]);
+
+		blockPosition += run;
+		count += run;
+	}
+
+	return count;
+}
+
+
+// Description: Reads the next arrival into "arrival" and returns "true",
+//				or returns "false" at the end of the trace.
+// Precondition: The trace has arrival time and transaction length columns.
+// Time Efficiency: O(1) amortized
+bool BinaryTraceReader::next(Event& arrival) {
+
+	if (arrivalColumn < 0 || lengthColumn < 0) {
+		fail("binary trace has no arrival time and transaction length columns");
+		return false;
+	}
+
+	if (!hasRow())
+		return false;
+
+	arrival = Event(ARRIVAL, blockColumns[arrivalColumn][blockPosition],
+		blockColumns[lengthColumn][blockPosition]);
+	blockPosition++;
+
+	return true;
+}
+
+
+// Description: Reads exactly "length" bytes and returns "true", or
+//				returns "false" at the end of the file.
+// Time Efficiency: O(length)
+bool BinaryTraceReader::readBytes(unsigned char* bytes, size_t length) {
+
+	size_t done = 0;
+
+	while (done < length) {
+		ssize_t count = read(fileDescriptor, bytes + done, length - done);
+
+		if (count > 0)
+			done += count;
+		else if (count == 0 || errno != EINTR)
+			return false;
+	}
+
+	return true;
+}
+
+
+// Description: Records "message" as the error and stops reading.
+// Time Efficiency: O(1)
+void BinaryTraceReader::fail(const string& message) {
+
+	if (error.empty())
+		error = message;
+
+	ended = true;
+	blockRows = 0;
+	blockPosition = 0;
+}
+
+
+// Description: Reads and checks the header.
+// Time Efficiency: O(columns)
+void BinaryTraceReader::readHeader() {
+
+	unsigned char fixed[8];
+	unsigned char checksum[4];
+
+	if (!readBytes(fixed, 8) || memcmp(fixed, TRACE_MAGIC, 4) != 0) {
+		fail("input is not a binary trace");
+		return;
+	}
+
+	if (decodeFixed(fixed + 4, 2) != (unsigned)TRACE_VERSION) {
+		fail("unsupported binary trace version");
+		return;
+	}
+
+	// The checksum covers the fixed part and the column specs
+	vector<unsigned char> header(fixed, fixed + 8);
+	int columnCount = decodeFixed(fixed + 6, 2);
+
+	header.resize(8 + 2 * columnCount);
+	if (!readBytes(header.data() + 8, 2 * columnCount) || !readBytes(checksum, 4)) {
+		fail("binary trace header is truncated");
+		return;
+	}
+
+	if (traceChecksum(&header[0], header.size()) != decodeFixed(checksum, 4)) {
+		fail("binary trace header checksum does not match");
+		return;
+	}
+
+	for (int i = 0; i < columnCount; i++) {
+		ColumnSpec spec;
+		spec.column = (TraceColumn)header[8 + 2 * i];
+		spec.encoding = (ColumnEncoding)header[9 + 2 * i];
+
+		if (spec.encoding != VARINT_ENCODING && spec.encoding != DELTA_VARINT_ENCODING) {
+			fail("binary trace has an unknown column encoding");
+			return;
+		}
+
+		if (spec.column == ARRIVAL_TIME_COLUMN && arrivalColumn < 0)
+			arrivalColumn = i;
+		if (spec.column == TRANSACTION_LENGTH_COLUMN && lengthColumn < 0)
+			lengthColumn = i;
+
+		columns.push_back(spec);
+	}
+
+	blockColumns.resize(columnCount);
+}
+
+
+// Description: Reads, checks and decodes the next block, and returns
+//				"true" if it has rows.
+// Time Efficiency: O(rows in block)
+bool BinaryTraceReader::readBlock() {
+
+	unsigned char blockHeader[12];
+
+	if (!readBytes(blockHeader, 4)) {
+		fail("binary trace is truncated");
+		return false;
+	}
+
+	unsigned int rows = decodeFixed(blockHeader, 4);
+
+	// A row count of 0 marks the end, followed by the total row count
+	if (rows == 0) {
+		unsigned char total[8];
+
+		if (!readBytes(total, 8))
+			fail("binary trace is truncated");
+		else if ((long long)decodeFixed(total, 8) != totalRows)
+			fail("binary trace row count does not match");
+
+		ended = true;
+		return false;
+	}
+
+	if (!readBytes(blockHeader + 4, 8) || rows > (unsigned)TRACE_BLOCK_ROWS) {
+		fail("binary trace block header is corrupt");
+		return false;
+	}
+
+	size_t payloadLength = decodeFixed(blockHeader + 4, 4);
+	if (payloadLength > (size_t)TRACE_BLOCK_ROWS * columns.size() * 5) {
+		fail("binary trace block header is corrupt");
+		return false;
+	}
+
+	payload.resize(payloadLength);
+	if (payloadLength > 0 && !readBytes(&payload[0], payloadLength)) {
+		fail("binary trace is truncated");
+		return false;
+	}
+
+	if (traceChecksum(payload.empty() ? NULL : &payload[0], payloadLength) != decodeFixed(blockHeader + 8, 4)) {
+		fail("binary trace block checksum does not match");
+		return false;
+	}
+
+	// Decode each column's varints, undoing the delta encoding
+	size_t position = 0;
+
+	for (size_t i = 0; i < columns.size(); i++) {
+		vector<int>& values = blockColumns[i];
+		unsigned int previous = 0;
+
+		values.resize(rows);
+		for (unsigned int row = 0; row < rows; row++) {
+			unsigned int value = 0;
+			int shift = 0;
+
+			do {
+				if (position == payloadLength || shift > 28) {
+					fail("binary trace block is corrupt");
+					return false;
+				}
+				value |= (unsigned int)(payload[position] & 0x7F) << shift;
+				shift += 7;
+			} while (payload[position++] & 0x80);
+
+			if (columns[i].encoding == DELTA_VARINT_ENCODING) {
+				previous += (unsigned int)zigzagDecode(value);
+				values[row] = (int)previous;
+			}
+			else
+				values[row] = zigzagDecode(value);
+		}
+	}
+
+	if (position != payloadLength) {
+		fail("binary trace block is corrupt");
+		return false;
+	}
+
+	blockRows = rows;
+	blockPosition = 0;
+	totalRows += rows;
+
+	return true;
+}
+
+
+// Description: Makes sure the current block has a row left to return,
+//				reading the next block if needed; returns "false" at
+//				the end of the trace.
+// Time Efficiency: O(1) amortized
+bool BinaryTraceReader::hasRow() {
+
+	if (blockPosition < blockRows)
+		return true;
+
+	if (ended)
+		return false;
+
+	return readBlock();
+}
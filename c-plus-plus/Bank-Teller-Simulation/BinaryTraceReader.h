@@ -0,0 +1,110 @@
+/*
+* BinaryTraceReader.h
+*
+* Class Description: Reads a binary trace (see BinaryTraceFormat.h) from a
+*					 file descriptor, one block at a time. Every block is
+*					 checked against its checksum before its rows are used.
+*					 Rows can be read as plain int arrays, or, for a trace
+*					 with arrival time and transaction length columns, as
+*					 arrival events through the same readBatch() and next()
+*					 methods as TraceReader.
+*					 Reading stops at the end marker or at the first error;
+*					 hasFailed() tells the two apart.
+* Class Invariant: blockColumns holds the decoded rows of the current block;
+*				   rows before blockPosition have been returned.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <string>
+#include <vector>
+#include "BinaryTraceFormat.h"
+#include "Event.h"
+
+using namespace std;
+
+class BinaryTraceReader {
+
+	private:
+		int fileDescriptor;					// File the trace is read from
+		vector<ColumnSpec> columns;			// The trace's columns
+		vector< vector<int> > blockColumns;	// Values of the current block, by column
+		vector<unsigned char> payload;		// Encoded payload of the current block
+		int blockRows;						// Number of rows in the current block
+		int blockPosition;					// Index of the next row of the block to return
+		long long totalRows;				// Number of rows read so far
+		bool ended;							// Whether the end marker, or an error, was reached
+		string error;						// Why reading failed, or empty
+		int arrivalColumn;					// Index of the arrival time column, or -1
+		int lengthColumn;					// Index of the transaction length column, or -1
+
+		// Readers own their file position; they are not copied
+		BinaryTraceReader(const BinaryTraceReader& aReader);
+		BinaryTraceReader& operator=(const BinaryTraceReader& aReader);
+
+		// Description: Reads exactly "length" bytes and returns "true", or
+		//				returns "false" at the end of the file.
+		// Time Efficiency: O(length)
+		bool readBytes(unsigned char* bytes, size_t length);
+
+		// Description: Records "message" as the error and stops reading.
+		// Time Efficiency: O(1)
+		void fail(const string& message);
+
+		// Description: Reads and checks the header.
+		// Time Efficiency: O(columns)
+		void readHeader();
+
+		// Description: Reads, checks and decodes the next block, and returns
+		//				"true" if it has rows.
+		// Time Efficiency: O(rows in block)
+		bool readBlock();
+
+		// Description: Makes sure the current block has a row left to return,
+		//				reading the next block if needed; returns "false" at
+		//				the end of the trace.
+		// Time Efficiency: O(1) amortized
+		bool hasRow();
+
+	public:
+		// Constructor; reads the header from standard input by default
+		BinaryTraceReader(int traceFileDescriptor = 0);
+
+		// Description: Returns "true" if the trace could not be read, for
+		//				example because it is truncated or a checksum is wrong.
+		// Time Efficiency: O(1)
+		bool hasFailed() const;
+
+		// Description: Returns why reading failed, or an empty string.
+		// Time Efficiency: O(1)
+		const string& getError() const;
+
+		// Description: Returns the number of columns in the trace.
+		// Time Efficiency: O(1)
+		int getColumnCount() const;
+
+		// Description: Returns the spec of column "index".
+		// Precondition: index is less than getColumnCount().
+		// Time Efficiency: O(1)
+		ColumnSpec getColumn(int index) const;
+
+		// Description: Reads up to "capacity" rows into "rows", one value per
+		//				column for each row, and returns how many were read,
+		//				or 0 at the end of the trace.
+		// Time Efficiency: O(values read) amortized
+		int readRows(int* rows, int capacity);
+
+		// Description: Reads up to "capacity" arrivals into "arrivals" and
+		//				returns how many were read, or 0 at the end of the trace.
+		// Precondition: The trace has arrival time and transaction length columns.
+		// Time Efficiency: O(arrivals read) amortized
+		int readBatch(Event* arrivals, int capacity);
+
+		// Description: Reads the next arrival into "arrival" and returns "true",
+		//				or returns "false" at the end of the trace.
+		// Precondition: The trace has arrival time and transaction length columns.
+		// Time Efficiency: O(1) amortized
+		bool next(Event& arrival);
+
+}; // end BinaryTraceReader
@@ -0,0 +1,156 @@
+/*
+* BinaryTraceWriter.cpp
+*
+* Class Description: Writes a binary trace (see BinaryTraceFormat.h) to a
+*					 file descriptor, one row at a time.
+* Class Invariant: The header has been written; blockColumns holds the rows
+*				   not yet written, fewer than TRACE_BLOCK_ROWS.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <cerrno>
+#include <unistd.h>
+#include "BinaryTraceWriter.h"
+
+using namespace std;
+
+
+// Description: Appends "value" to "bytes" as "width" little-endian bytes.
+// Time Efficiency: O(width)
+static void appendFixed(vector<unsigned char>& bytes, unsigned long long value, int width) {
+
+	for (int i = 0; i < width; i++)
+		bytes.push_back((unsigned char)(value >> (8 * i)));
+}
+
+
+// Constructor; writes the header for the given columns
+BinaryTraceWriter::BinaryTraceWriter(int traceFileDescriptor, const ColumnSpec* columnSpecs, int columnCount) {
+
+	fileDescriptor = traceFileDescriptor;
+	columns.assign(columnSpecs, columnSpecs + columnCount);
+	blockColumns.resize(columnCount);
+	blockRows = 0;
+	totalRows = 0;
+	finished = false;
+	failed = false;
+
+	vector<unsigned char> header(TRACE_MAGIC, TRACE_MAGIC + 4);
+	appendFixed(header, TRACE_VERSION, 2);
+	appendFixed(header, columnCount, 2);
+	for (int i = 0; i < columnCount; i++) {
+		header.push_back(columns[i].column);
+		header.push_back(columns[i].encoding);
+	}
+	appendFixed(header, traceChecksum(&header[0], header.size()), 4);
+
+	writeBytes(header);
+}
+
+
+// Destructor; finishes the trace if finish() was not called.
+// The file descriptor is not closed
+BinaryTraceWriter::~BinaryTraceWriter() {
+	finish();
+}
+
+
+// Description: Appends a row holding one value per column, in column order.
+// Precondition: finish() has not been called.
+// Time Efficiency: O(columns) amortized
+void BinaryTraceWriter::append(const int* row) {
+
+	for (size_t i = 0; i < columns.size(); i++)
+		blockColumns[i].push_back(row[i]);
+
+	blockRows++;
+	totalRows++;
+
+	if (blockRows == TRACE_BLOCK_ROWS)
+		flushBlock();
+}
+
+
+// Description: Writes the remaining rows and the end marker, and returns
+//				"true" if every write succeeded.
+// Time Efficiency: O(rows in block)
+bool BinaryTraceWriter::finish() {
+
+	if (!finished) {
+		vector<unsigned char> end;
+
+		flushBlock();
+		appendFixed(end, 0, 4);
+		appendFixed(end, totalRows, 8);
+		writeBytes(end);
+		finished = true;
+	}
+
+	return !failed;
+}
+
+
+// Description: Returns the number of rows appended.
+// Time Efficiency: O(1)
+long long BinaryTraceWriter::getRowCount() const {
+	return totalRows;
+}
+
+
+// Description: Writes "bytes" to the file, recording any failure.
+// Time Efficiency: O(bytes)
+void BinaryTraceWriter::writeBytes(const vector<unsigned char>& bytes) {
+
+	size_t written = 0;
+
+	while (written < bytes.size() && !failed) {
+		ssize_t count = write(fileDescriptor, &bytes[written], bytes.size() - written);
+
+		if (count > 0)
+			written += count;
+		else if (count < 0 && errno != EINTR)
+			failed = true;
+	}
+}
+
+
+// Description: Encodes and writes the current block, if it has rows.
+// Time Efficiency: O(rows in block)
+void BinaryTraceWriter::flushBlock() {
+
+	if (blockRows == 0)
+		return;
+
+	// Leave room for the block header, then encode the columns after it
+	vector<unsigned char> block(12);
+
+	for (size_t i = 0; i < columns.size(); i++) {
+		const vector<int>& values = blockColumns[i];
+		unsigned int previous = 0;
+
+		for (int row = 0; row < blockRows; row++) {
+			if (columns[i].encoding == DELTA_VARINT_ENCODING) {
+				// Wrapping unsigned subtraction, undone by wrapping addition
+				appendVarint(block, zigzagEncode((int)((unsigned int)values[row] - previous)));
+				previous = (unsigned int)values[row];
+			}
+			else
+				appendVarint(block, zigzagEncode(values[row]));
+		}
+
+		blockColumns[i].clear();
+	}
+
+	size_t payloadLength = block.size() - 12;
+	unsigned int checksum = traceChecksum(&block[12], payloadLength);
+
+	for (int i = 0; i < 4; i++) {
+		block[i] = (unsigned char)(blockRows >> (8 * i));
+		block[4 + i] = (unsigned char)(payloadLength >> (8 * i));
+		block[8 + i] = (unsigned char)(checksum >> (8 * i));
+	}
+
+	writeBytes(block);
+	blockRows = 0;
+}
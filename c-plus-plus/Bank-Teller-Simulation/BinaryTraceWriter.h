@@ -0,0 +1,65 @@
+/*
+* BinaryTraceWriter.h
+*
+* Class Description: Writes a binary trace (see BinaryTraceFormat.h) to a
+*					 file descriptor, one row at a time. Rows are collected
+*					 into a block of columns, which is encoded and written
+*					 when it is full, so memory does not grow with the trace.
+* Class Invariant: The header has been written; blockColumns holds the rows
+*				   not yet written, fewer than TRACE_BLOCK_ROWS.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <vector>
+#include "BinaryTraceFormat.h"
+
+using namespace std;
+
+class BinaryTraceWriter {
+
+	private:
+		int fileDescriptor;					// File the trace is written to
+		vector<ColumnSpec> columns;			// The trace's columns
+		vector< vector<int> > blockColumns;	// Values of the current block, by column
+		int blockRows;						// Number of rows in the current block
+		long long totalRows;				// Number of rows appended
+		bool finished;						// Whether the end marker has been written
+		bool failed;						// Whether a write has failed
+
+		// Writers own their file position; they are not copied
+		BinaryTraceWriter(const BinaryTraceWriter& aWriter);
+		BinaryTraceWriter& operator=(const BinaryTraceWriter& aWriter);
+
+		// Description: Writes "bytes" to the file, recording any failure.
+		// Time Efficiency: O(bytes)
+		void writeBytes(const vector<unsigned char>& bytes);
+
+		// Description: Encodes and writes the current block, if it has rows.
+		// Time Efficiency: O(rows in block)
+		void flushBlock();
+
+	public:
+		// Constructor; writes the header for the given columns
+		BinaryTraceWriter(int traceFileDescriptor, const ColumnSpec* columnSpecs, int columnCount);
+
+		// Destructor; finishes the trace if finish() was not called.
+		// The file descriptor is not closed
+		~BinaryTraceWriter();
+
+		// Description: Appends a row holding one value per column, in column order.
+		// Precondition: finish() has not been called.
+		// Time Efficiency: O(columns) amortized
+		void append(const int* row);
+
+		// Description: Writes the remaining rows and the end marker, and returns
+		//				"true" if every write succeeded.
+		// Time Efficiency: O(rows in block)
+		bool finish();
+
+		// Description: Returns the number of rows appended.
+		// Time Efficiency: O(1)
+		long long getRowCount() const;
+
+}; // end BinaryTraceWriter
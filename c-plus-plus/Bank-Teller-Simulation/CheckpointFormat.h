@@ -0,0 +1,74 @@
+/*
+* CheckpointFormat.h
+*
+* Description: Constants and encoding helpers shared by CheckpointReader
+*			   and CheckpointWriter.
+*
+*			   A checkpoint holds the whole state of a BankSimulation part
+*			   way through a run, stored as follows (all fixed width fields
+*			   little-endian):
+*
+*			   Header:  "BCKP", u16 version, u16 0, u64 payload length,
+*						u32 checksum of the payload.
+*			   Payload: the values written by BankSimulation, in the order
+*						it writes them; see BankSimulation::writeCheckpoint().
+*
+*			   Integers are zigzag-encoded 64-bit varints, so small values
+*			   of either sign take a byte; doubles are their 8 IEEE 754
+*			   bytes, so they are restored exactly; strings are a varint
+*			   length and their bytes. The checksum is 32-bit FNV-1a, as in
+*			   binary traces.
+*			   A checkpoint is written to a temporary file that is then
+*			   renamed over the last one, so a run killed while writing
+*			   still leaves the previous checkpoint whole.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <vector>
+#include "BinaryTraceFormat.h"
+
+using namespace std;
+
+const unsigned char CHECKPOINT_MAGIC[4] = { 'B', 'C', 'K', 'P' };
+const int CHECKPOINT_VERSION = 2;
+const int CHECKPOINT_HEADER_SIZE = 20;	// Bytes of the header
+
+
+// Description: Maps a signed 64-bit value to an unsigned one, small
+//				magnitudes first.
+// Time Efficiency: O(1)
+inline unsigned long long zigzagEncode64(long long value) {
+	return ((unsigned long long)value << 1) ^ (unsigned long long)(value >> 63);
+}
+
+
+// Description: Inverse of zigzagEncode64.
+// Time Efficiency: O(1)
+inline long long zigzagDecode64(unsigned long long value) {
+	return (long long)((value >> 1) ^ (0ull - (value & 1)));
+}
+
+
+// Description: Appends the low "width" bytes of "value" to "bytes",
+//				little-endian.
+// Time Efficiency: O(width)
+inline void appendFixed(vector<unsigned char>& bytes, unsigned long long value, int width) {
+
+	for (int i = 0; i < width; i++)
+		bytes.push_back((unsigned char)(value >> (8 * i)));
+}
+
+
+// Description: Returns "width" little-endian bytes as a number.
+// Time Efficiency: O(width)
+inline unsigned long long readFixed(const unsigned char* bytes, int width) {
+
+	unsigned long long value = 0;
+
+	for (int i = width - 1; i >= 0; i--)
+		value = (value << 8) | bytes[i];
+
+	return value;
+}
@@ -0,0 +1,180 @@
+/*
+* CheckpointReader.cpp
+*
+* Class Description: Reads a checkpoint from a file, checks it, and
+*					 decodes its values in the order they were written.
+* Class Invariant: Values before "position" in payload have been read.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include "CheckpointReader.h"
+
+using namespace std;
+
+
+// Constructor; reads and checks the checkpoint at "path"
+CheckpointReader::CheckpointReader(const string& path) {
+
+	unsigned char header[CHECKPOINT_HEADER_SIZE];
+	ifstream file(path.c_str(), ios::binary);
+
+	position = 0;
+
+	if (!file) {
+		fail("cannot open " + path + ": " + strerror(errno));
+		return;
+	}
+
+	if (!file.read((char*)header, CHECKPOINT_HEADER_SIZE)
+		|| memcmp(header, CHECKPOINT_MAGIC, 4) != 0) {
+		fail(path + " is not a checkpoint");
+		return;
+	}
+
+	if ((int)readFixed(header + 4, 2) != CHECKPOINT_VERSION) {
+		fail(path + " is a checkpoint of another version");
+		return;
+	}
+
+	unsigned long long length = readFixed(header + 8, 8);
+	unsigned int checksum = (unsigned int)readFixed(header + 16, 4);
+
+	// Read the payload in one go, checking the file is as long as it says
+	file.seekg(0, ios::end);
+	if ((unsigned long long)file.tellg() != CHECKPOINT_HEADER_SIZE + length) {
+		fail(path + " is truncated");
+		return;
+	}
+	file.seekg(CHECKPOINT_HEADER_SIZE);
+
+	payload.resize(length);
+	if (!file.read((char*)payload.data(), length)) {
+		fail("cannot read " + path);
+		return;
+	}
+
+	if (traceChecksum(payload.data(), payload.size()) != checksum)
+		fail(path + " is corrupt: checksum mismatch");
+}
+
+
+// Description: Returns "true" if the checkpoint could not be read,
+//				for example because it is truncated or its checksum
+//				is wrong, or fail() was called.
+// Time Efficiency: O(1)
+bool CheckpointReader::hasFailed() const {
+	return !error.empty();
+}
+
+
+// Description: Returns why reading failed, or an empty string.
+// Time Efficiency: O(1)
+const string& CheckpointReader::getError() const {
+	return error;
+}
+
+
+// Description: Records "message" as the error, if there is none yet,
+//				and stops reading; for values that decode but make no
+//				sense.
+// Time Efficiency: O(1)
+void CheckpointReader::fail(const string& message) {
+
+	if (error.empty())
+		error = message;
+	position = payload.size();
+}
+
+
+// Description: Returns "true" once every value has been read.
+// Time Efficiency: O(1)
+bool CheckpointReader::isAtEnd() const {
+	return position == payload.size();
+}
+
+
+// Description: Reads a signed integer.
+// Time Efficiency: O(1)
+long long CheckpointReader::readInt() {
+	return zigzagDecode64(readUnsigned());
+}
+
+
+// Description: Reads an unsigned integer.
+// Time Efficiency: O(1)
+unsigned long long CheckpointReader::readUnsigned() {
+
+	unsigned long long value = 0;
+
+	for (int shift = 0; shift < 64; shift += 7) {
+		if (position == payload.size()) {
+			fail("checkpoint ends in the middle of a value");
+			return 0;
+		}
+
+		unsigned char byte = payload[position++];
+		value |= (unsigned long long)(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0)
+			return value;
+	}
+
+	fail("checkpoint has a value longer than 64 bits");
+	return 0;
+}
+
+
+// Description: Reads a double.
+// Time Efficiency: O(1)
+double CheckpointReader::readDouble() {
+
+	double value = 0.0;
+
+	if (payload.size() - position < 8) {
+		fail("checkpoint ends in the middle of a value");
+		return value;
+	}
+
+	unsigned long long bits = readFixed(payload.data() + position, 8);
+	memcpy(&value, &bits, sizeof(value));
+	position += 8;
+
+	return value;
+}
+
+
+// Description: Reads a string.
+// Time Efficiency: O(length)
+string CheckpointReader::readString() {
+
+	unsigned long long length = readUnsigned();
+
+	if (length > payload.size() - position) {
+		fail("checkpoint ends in the middle of a value");
+		return string();
+	}
+
+	string value(payload.begin() + position, payload.begin() + position + length);
+	position += length;
+
+	return value;
+}
+
+
+// Description: Reads a count of items that follow, failing if it is
+//				negative or larger than "limit".
+// Time Efficiency: O(1)
+int CheckpointReader::readCount(long long limit) {
+
+	long long count = readInt();
+
+	if (count < 0 || count > limit) {
+		fail("checkpoint has an impossible count");
+		return 0;
+	}
+
+	return (int)count;
+}
@@ -0,0 +1,75 @@
+/*
+* CheckpointReader.h
+*
+* Class Description: Reads a checkpoint (see CheckpointFormat.h) from a
+*					 file, checks its header and checksum, and decodes its
+*					 values in the order they were written.
+*					 Reading stops at the first error: every later read
+*					 returns 0 or an empty string, and hasFailed() is
+*					 "true", so a caller can read a whole section and check
+*					 once at the end.
+* Class Invariant: Values before "position" in payload have been read.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <string>
+#include <vector>
+#include "CheckpointFormat.h"
+
+using namespace std;
+
+class CheckpointReader {
+
+	private:
+		vector<unsigned char> payload;	// Encoded values of the checkpoint
+		size_t position;				// Index of the next byte to decode
+		string error;					// Why reading failed, or empty
+
+	public:
+		// Constructor; reads and checks the checkpoint at "path"
+		CheckpointReader(const string& path);
+
+		// Description: Returns "true" if the checkpoint could not be read,
+		//				for example because it is truncated or its checksum
+		//				is wrong, or fail() was called.
+		// Time Efficiency: O(1)
+		bool hasFailed() const;
+
+		// Description: Returns why reading failed, or an empty string.
+		// Time Efficiency: O(1)
+		const string& getError() const;
+
+		// Description: Records "message" as the error, if there is none yet,
+		//				and stops reading; for values that decode but make no
+		//				sense.
+		// Time Efficiency: O(1)
+		void fail(const string& message);
+
+		// Description: Returns "true" once every value has been read.
+		// Time Efficiency: O(1)
+		bool isAtEnd() const;
+
+		// Description: Reads a signed integer.
+		// Time Efficiency: O(1)
+		long long readInt();
+
+		// Description: Reads an unsigned integer.
+		// Time Efficiency: O(1)
+		unsigned long long readUnsigned();
+
+		// Description: Reads a double.
+		// Time Efficiency: O(1)
+		double readDouble();
+
+		// Description: Reads a string.
+		// Time Efficiency: O(length)
+		string readString();
+
+		// Description: Reads a count of items that follow, failing if it is
+		//				negative or larger than "limit".
+		// Time Efficiency: O(1)
+		int readCount(long long limit);
+
+}; // end CheckpointReader
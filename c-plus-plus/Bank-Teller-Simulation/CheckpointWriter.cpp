@@ -0,0 +1,131 @@
+/*
+* CheckpointWriter.cpp
+*
+* Class Description: Encodes the values of a checkpoint into memory and
+*					 saves them to a file, replacing it atomically.
+* Class Invariant: payload holds every value written, encoded.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include "CheckpointWriter.h"
+
+using namespace std;
+
+
+// Constructor
+CheckpointWriter::CheckpointWriter() {
+}
+
+
+// Description: Writes a signed integer.
+// Time Efficiency: O(1)
+void CheckpointWriter::writeInt(long long value) {
+	writeUnsigned(zigzagEncode64(value));
+}
+
+
+// Description: Writes an unsigned integer, such as a seed.
+// Time Efficiency: O(1)
+void CheckpointWriter::writeUnsigned(unsigned long long value) {
+
+	while (value >= 0x80) {
+		payload.push_back((unsigned char)(value | 0x80));
+		value >>= 7;
+	}
+	payload.push_back((unsigned char)value);
+}
+
+
+// Description: Writes a double exactly.
+// Time Efficiency: O(1)
+void CheckpointWriter::writeDouble(double value) {
+
+	unsigned long long bits;
+
+	memcpy(&bits, &value, sizeof(bits));
+	appendFixed(payload, bits, 8);
+}
+
+
+// Description: Writes a string.
+// Time Efficiency: O(length)
+void CheckpointWriter::writeString(const string& value) {
+
+	writeUnsigned(value.size());
+	payload.insert(payload.end(), value.begin(), value.end());
+}
+
+
+// Description: Returns the number of bytes of values written.
+// Time Efficiency: O(1)
+size_t CheckpointWriter::getSize() const {
+	return payload.size();
+}
+
+
+// Description: Writes the checkpoint to "path" by way of a temporary
+//				file, flushed to disk, that is renamed over it. Returns
+//				"true" if successful, otherwise "false" with the reason
+//				in "error"; "path" is then unchanged.
+// Time Efficiency: O(size)
+bool CheckpointWriter::save(const string& path, string& error) const {
+
+	string temporaryPath = path + ".tmp";
+	vector<unsigned char> header;
+
+	header.insert(header.end(), CHECKPOINT_MAGIC, CHECKPOINT_MAGIC + 4);
+	appendFixed(header, CHECKPOINT_VERSION, 2);
+	appendFixed(header, 0, 2);
+	appendFixed(header, payload.size(), 8);
+	appendFixed(header, traceChecksum(payload.data(), payload.size()), 4);
+
+	int fileDescriptor = open(temporaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fileDescriptor < 0) {
+		error = "cannot create " + temporaryPath + ": " + strerror(errno);
+		return false;
+	}
+
+	// Write the header, then the payload, resuming after short writes
+	const vector<unsigned char>* parts[] = { &header, &payload };
+	for (int part = 0; part < 2; part++) {
+		const unsigned char* bytes = parts[part]->data();
+		size_t remaining = parts[part]->size();
+
+		while (remaining > 0) {
+			ssize_t written = write(fileDescriptor, bytes, remaining);
+
+			if (written < 0 && errno == EINTR)
+				continue;
+			if (written <= 0) {
+				error = "cannot write " + temporaryPath + ": " + strerror(errno);
+				close(fileDescriptor);
+				unlink(temporaryPath.c_str());
+				return false;
+			}
+			bytes += written;
+			remaining -= written;
+		}
+	}
+
+	// The data must be on disk before the rename makes it the checkpoint
+	bool synced = fsync(fileDescriptor) == 0;
+	if (close(fileDescriptor) != 0 || !synced) {
+		error = "cannot write " + temporaryPath + ": " + strerror(errno);
+		unlink(temporaryPath.c_str());
+		return false;
+	}
+
+	if (rename(temporaryPath.c_str(), path.c_str()) != 0) {
+		error = "cannot replace " + path + ": " + strerror(errno);
+		unlink(temporaryPath.c_str());
+		return false;
+	}
+
+	return true;
+}
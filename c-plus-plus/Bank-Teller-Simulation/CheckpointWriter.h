@@ -0,0 +1,57 @@
+/*
+* CheckpointWriter.h
+*
+* Class Description: Encodes the values of a checkpoint (see
+*					 CheckpointFormat.h) into memory, in the order they are
+*					 written, and saves them to a file with the header and
+*					 checksum. The file is replaced atomically, so it always
+*					 holds one whole checkpoint.
+* Class Invariant: payload holds every value written, encoded.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <string>
+#include <vector>
+#include "CheckpointFormat.h"
+
+using namespace std;
+
+class CheckpointWriter {
+
+	private:
+		vector<unsigned char> payload;	// Encoded values written so far
+
+	public:
+		// Constructor
+		CheckpointWriter();
+
+		// Description: Writes a signed integer.
+		// Time Efficiency: O(1)
+		void writeInt(long long value);
+
+		// Description: Writes an unsigned integer, such as a seed.
+		// Time Efficiency: O(1)
+		void writeUnsigned(unsigned long long value);
+
+		// Description: Writes a double exactly.
+		// Time Efficiency: O(1)
+		void writeDouble(double value);
+
+		// Description: Writes a string.
+		// Time Efficiency: O(length)
+		void writeString(const string& value);
+
+		// Description: Returns the number of bytes of values written.
+		// Time Efficiency: O(1)
+		size_t getSize() const;
+
+		// Description: Writes the checkpoint to "path" by way of a temporary
+		//				file, flushed to disk, that is renamed over it. Returns
+		//				"true" if successful, otherwise "false" with the reason
+		//				in "error"; "path" is then unchanged.
+		// Time Efficiency: O(size)
+		bool save(const string& path, string& error) const;
+
+}; // end CheckpointWriter
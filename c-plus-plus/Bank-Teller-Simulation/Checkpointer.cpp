@@ -0,0 +1,101 @@
+/*
+* Checkpointer.cpp
+*
+* Class Description: Saves checkpoints to one file on a background thread,
+*					 one at a time, skipping those made while one is saved.
+* Class Invariant: "writer" is running, or joinable, only between a write()
+*				   and the next write() or finish().
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include "Checkpointer.h"
+
+using namespace std;
+
+
+// Constructor; checkpoints will replace the file at "checkpointPath"
+Checkpointer::Checkpointer(const string& checkpointPath) : saving(false) {
+	path = checkpointPath;
+	saved = 0;
+}
+
+
+// Destructor; waits for the checkpoint in flight to be saved
+Checkpointer::~Checkpointer() {
+	finish();
+}
+
+
+// Description: Starts a thread that calls encode() and saves what it
+//				writes, and returns "true", unless the previous checkpoint
+//				is still being saved; then this one is skipped and it
+//				returns "false". "encode" must own, or share, everything it
+//				reads.
+// Time Efficiency: O(1)
+bool Checkpointer::write(const function<void(CheckpointWriter&)>& encode) {
+
+	if (saving)
+		return false;
+
+	// The previous thread has saved its checkpoint, so joining it is immediate
+	finish();
+	saving = true;
+	writer = thread(&Checkpointer::save, this, encode);
+
+	return true;
+}
+
+
+// Description: Returns "true" while a checkpoint is being saved, when
+//				a write() would be skipped.
+// Time Efficiency: O(1)
+bool Checkpointer::isSaving() const {
+	return saving;
+}
+
+
+// Description: Waits for the checkpoint in flight, and returns "true"
+//				if every checkpoint was saved.
+// Time Efficiency: The rest of the checkpoint in flight
+bool Checkpointer::finish() {
+
+	if (writer.joinable())
+		writer.join();
+
+	return error.empty();
+}
+
+
+// Description: Returns the number of checkpoints saved so far.
+// Time Efficiency: O(1)
+long long Checkpointer::getSavedCount() const {
+	return saved;
+}
+
+
+// Description: Returns why a checkpoint could not be saved, or an
+//				empty string.
+// Time Efficiency: O(1)
+const string& Checkpointer::getError() const {
+	return error;
+}
+
+
+// Description: Encodes a checkpoint with "encode" and saves it.
+// Time Efficiency: O(checkpoint size)
+void Checkpointer::save(const function<void(CheckpointWriter&)>& encode) {
+
+	CheckpointWriter checkpoint;
+	string saveError;
+
+	encode(checkpoint);
+
+	// Only this thread touches "saved" and "error" until it is joined
+	if (checkpoint.save(path, saveError))
+		saved++;
+	else if (error.empty())
+		error = saveError;
+
+	saving = false;
+}
@@ -0,0 +1,78 @@
+/*
+* Checkpointer.h
+*
+* Class Description: Saves checkpoints to one file on a background thread,
+*					 so a simulation only pauses long enough to copy its
+*					 state. write() hands over a function that encodes a
+*					 snapshot into a CheckpointWriter; it runs, and the
+*					 result is saved, while the simulation carries on. At
+*					 most one checkpoint is in flight: a write() made while
+*					 the one before it is still being saved is skipped, so
+*					 the simulation never waits for a checkpoint.
+* Class Invariant: "writer" is running, or joinable, only between a write()
+*				   and the next write() or finish().
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include "CheckpointWriter.h"
+
+using namespace std;
+
+class Checkpointer {
+
+	private:
+		string path;			// File every checkpoint replaces
+		thread writer;			// Thread saving the latest checkpoint
+		atomic<bool> saving;	// "writer" has not finished saving
+		long long saved;		// Number of checkpoints saved
+		string error;			// Why the first failed checkpoint failed, or empty
+
+		// Checkpointers own their thread; they are not copied
+		Checkpointer(const Checkpointer& aCheckpointer);
+		Checkpointer& operator=(const Checkpointer& aCheckpointer);
+
+		// Description: Encodes a checkpoint with "encode" and saves it.
+		// Time Efficiency: O(checkpoint size)
+		void save(const function<void(CheckpointWriter&)>& encode);
+
+	public:
+		// Constructor; checkpoints will replace the file at "checkpointPath"
+		Checkpointer(const string& checkpointPath);
+
+		// Destructor; waits for the checkpoint in flight to be saved
+		~Checkpointer();
+
+		// Description: Starts a thread that calls encode() and saves what
+		//				it writes, and returns "true", unless the previous
+		//				checkpoint is still being saved; then this one is
+		//				skipped and it returns "false". "encode" must own, or
+		//				share, everything it reads.
+		// Time Efficiency: O(1)
+		bool write(const function<void(CheckpointWriter&)>& encode);
+
+		// Description: Returns "true" while a checkpoint is being saved, when
+		//				a write() would be skipped.
+		// Time Efficiency: O(1)
+		bool isSaving() const;
+
+		// Description: Waits for the checkpoint in flight, and returns "true"
+		//				if every checkpoint was saved.
+		// Time Efficiency: The rest of the checkpoint in flight
+		bool finish();
+
+		// Description: Returns the number of checkpoints saved so far.
+		// Time Efficiency: O(1)
+		long long getSavedCount() const;
+
+		// Description: Returns why a checkpoint could not be saved, or an
+		//				empty string.
+		// Time Efficiency: O(1)
+		const string& getError() const;
+
+}; // end Checkpointer
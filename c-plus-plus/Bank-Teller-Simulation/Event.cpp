@@ -2,7 +2,7 @@
 * Event.cpp
 *
 * Class Description: A bank customer event
-* Class Invariant: Event type will be "arrival" or "departure".
+* Class Invariant: Event type will be ARRIVAL or DEPARTURE.
 *				   Transaction length will not be negative.*
 * Created on: June 20, 2017
 * Author: Andrew Adams
@@ -17,29 +17,33 @@ using namespace std;
 
 // Default constructor
 Event::Event() {
-	type = "arrival";
+	type = ARRIVAL;
 	time = 0;
 	length = 0;
+	customerClass = 0;
+	teller = 0;
 }
 
 
 // Parameterized constructor
-Event::Event(string eventType, int eventTime, int eventLength) {
+Event::Event(EventType eventType, int eventTime, int eventLength, int eventTeller) {
 
 	type = eventType;
 	time = eventTime;
 	length = eventLength;
+	customerClass = 0;
+	teller = (unsigned short)eventTeller;
 }
 
 
 // Description: Sets event type
-// Precondition: Type is "arrival" or "departure"
+// Precondition: Type is ARRIVAL or DEPARTURE
 // Time Efficiency: O(1) 
-bool Event::setType(string eventType) {
+bool Event::setType(EventType eventType) {
 
 	bool typeIsSet;
 
-	if(eventType == "arrival" || eventType == "departure") {
+	if(eventType == ARRIVAL || eventType == DEPARTURE) {
 		type = eventType;
 		typeIsSet = true;
 	}
@@ -86,41 +90,51 @@ bool Event::setLength(int eventLength) {
 }
 
 
-// Description: Returns event type
-// Postcondition: Type is not changed
-// Time Efficiency: O(1) 
-string Event::getType() {
-	return type;
-}
+// Description: Sets the teller serving the customer
+// Precondition: Teller is between 0 and 65535
+// Time Efficiency: O(1)
+bool Event::setTeller(int eventTeller) {
 
+	bool tellerIsSet;
 
-// Description: Returns time event begins
-// Postcondition: Time is not changed
-// Time Efficiency: O(1) 
-int Event::getTime() {
-	return time;
+	if(eventTeller >= 0 && eventTeller <= 0xFFFF) {
+		teller = (unsigned short)eventTeller;
+		tellerIsSet = true;
+	}
+	else
+		tellerIsSet = false;
+
+	return tellerIsSet;
 }
 
 
-// Description: Returns transaction length
-// Postcondition: Length is not changed
-// Time Efficiency: O(1) 
-int Event::getLength() {
-	return length;
+// Description: Sets the customer's priority class
+// Precondition: Class is between 0 and CUSTOMER_CLASS_COUNT - 1
+// Time Efficiency: O(1)
+bool Event::setCustomerClass(int eventClass) {
+
+	bool classIsSet;
+
+	if(eventClass >= 0 && eventClass < CUSTOMER_CLASS_COUNT) {
+		customerClass = (unsigned char)eventClass;
+		classIsSet = true;
+	}
+	else
+		classIsSet = false;
+
+	return classIsSet;
 }
 
 
-// Description: Overloaded operator to compare
-//				customer events
-// Postcondition: Returns true is "this" event time is
-//				  greater than rhs event time
-// Time Efficiency: O(1)
-bool Event::operator>(const Event &rhs) {
+// Description: Returns event type as printed, "arrival" or "departure"
+// Postcondition: Type is not changed
+// Time Efficiency: O(1) 
+const char* Event::getTypeName() const {
 
-	if (time > rhs.time)
-		return true;
+	if (type == ARRIVAL)
+		return "arrival";
 	else
-		return false;
+		return "departure";
 }
 
 
@@ -129,7 +143,7 @@ bool Event::operator>(const Event &rhs) {
 // Time Efficiency: O(1)
 ostream & operator<<(ostream & os, const Event & e) {
 
-	os << e.type << ", " << e.time << ", " << e.length << endl;
+	os << e.getTypeName() << ", " << e.time << ", " << e.length << endl;
 	
 	return os;
 }
\ No newline at end of file
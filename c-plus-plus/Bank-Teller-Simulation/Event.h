@@ -2,35 +2,55 @@
 * Event.h
 *
 * Class Description: A bank customer event
-* Class Invariant: Event type will be "arrival" or "departure".
+*					 A compact, trivially copyable value (12 bytes), so events
+*					 can be copied with memcpy into and out of queue arrays.
+*					 A departure records the teller the customer leaves.
+*					 Every customer is in a priority class, 0 (the default)
+*					 being served first; the class uses a byte of padding,
+*					 so it costs no space.
+* Class Invariant: Event type will be ARRIVAL or DEPARTURE.
 *				   Transaction length will not be negative.*
+*				   Customer class is between 0 and CUSTOMER_CLASS_COUNT - 1.
 * Created on: June 20, 2017
 * Author: Andrew Adams
 */
 
 #pragma once
+#include <iostream>
 #include <string>
+#include <type_traits>
 
 using namespace std;
 
+// Type of customer event
+enum EventType : unsigned char {
+	ARRIVAL,
+	DEPARTURE
+};
+
+// Number of priority classes customers can be in
+const int CUSTOMER_CLASS_COUNT = 8;
+
 class Event {
 
 	private:
-		string type;	// Type of customer event
-		int time;		// Time at which event begins
-		int length;		// Transaction length of customer
+		int time;			// Time at which event begins
+		int length;			// Transaction length of customer
+		EventType type;		// Type of customer event
+		unsigned char customerClass;	// Priority class of the customer, 0 first
+		unsigned short teller;	// Teller serving the customer (departures only)
 
 	public:
 		//Default constructor
 		Event();
 
 		// Parameterized constructor
-		Event(string eventType, int eventTime, int eventLength);
+		Event(EventType eventType, int eventTime, int eventLength, int eventTeller = 0);
 
 		// Description: Sets event type
-		// Precondition: Type is "arrival" or "departure"
+		// Precondition: Type is ARRIVAL or DEPARTURE
 		// Time Efficiency: O(1) 
-		bool setType(string eventType);
+		bool setType(EventType eventType);
 
 		// Description: Sets the time event starts
 		// Precondition: Time is not negative
@@ -42,30 +62,114 @@ class Event {
 		// Time Efficiency: O(1)
 		bool setLength(int eventLength);
 
+		// Description: Sets the teller serving the customer
+		// Precondition: Teller is between 0 and 65535
+		// Time Efficiency: O(1)
+		bool setTeller(int eventTeller);
+
+		// Description: Sets the customer's priority class
+		// Precondition: Class is between 0 and CUSTOMER_CLASS_COUNT - 1
+		// Time Efficiency: O(1)
+		bool setCustomerClass(int eventClass);
+
 		// Description: Returns event type
 		// Postcondition: Type is not changed
 		// Time Efficiency: O(1) 
-		string getType();
+		EventType getType() const;
+
+		// Description: Returns event type as printed, "arrival" or "departure"
+		// Postcondition: Type is not changed
+		// Time Efficiency: O(1) 
+		const char* getTypeName() const;
 
 		// Description: Returns time event begins
 		// Postcondition: Time is not changed
 		// Time Efficiency: O(1) 
-		int getTime();
+		int getTime() const;
 
 		// Description: Returns transaction length
 		// Postcondition: Length is not changed
 		// Time Efficiency: O(1) 
-		int getLength();
+		int getLength() const;
+
+		// Description: Returns the teller serving the customer
+		// Postcondition: Teller is not changed
+		// Time Efficiency: O(1)
+		int getTeller() const;
+
+		// Description: Returns the customer's priority class
+		// Postcondition: Class is not changed
+		// Time Efficiency: O(1)
+		int getCustomerClass() const;
 
 		// Description: Overloaded operator to compare
 		//				customer events
 		// Postcondition: Returns true is "this" event time is
 		//				  greater than rhs event time
 		// Time Efficiency: O(1)
-		bool operator>(const Event &rhs);
+		bool operator>(const Event &rhs) const;
 
 		// Description: Overloaded operator to print customer events
 		// Postcondition: Event is printed to screen and left unchanged
 		// Time Efficiency: O(1)
 		friend ostream & operator<<(ostream & os, const Event & e);
-}; // end Event.h
\ No newline at end of file
+}; // end Event.h
+
+
+// The simulation copies events in and out of its queues on every step;
+// keep them plain values
+static_assert(is_trivially_copyable<Event>::value, "Event must be trivially copyable");
+static_assert(sizeof(Event) <= 16, "Event must stay within 16 bytes");
+
+
+// The accessors below are called for every event processed, so they are
+// defined here where the compiler can inline them
+
+// Description: Returns event type
+// Postcondition: Type is not changed
+// Time Efficiency: O(1) 
+inline EventType Event::getType() const {
+	return type;
+}
+
+
+// Description: Returns time event begins
+// Postcondition: Time is not changed
+// Time Efficiency: O(1) 
+inline int Event::getTime() const {
+	return time;
+}
+
+
+// Description: Returns transaction length
+// Postcondition: Length is not changed
+// Time Efficiency: O(1) 
+inline int Event::getLength() const {
+	return length;
+}
+
+
+// Description: Returns the teller serving the customer
+// Postcondition: Teller is not changed
+// Time Efficiency: O(1)
+inline int Event::getTeller() const {
+	return teller;
+}
+
+
+// Description: Returns the customer's priority class
+// Postcondition: Class is not changed
+// Time Efficiency: O(1)
+inline int Event::getCustomerClass() const {
+	return customerClass;
+}
+
+
+// Description: Overloaded operator to compare
+//				customer events
+// Postcondition: Returns true is "this" event time is
+//				  greater than rhs event time
+// Time Efficiency: O(1)
+inline bool Event::operator>(const Event &rhs) const {
+	return time > rhs.time;
+}
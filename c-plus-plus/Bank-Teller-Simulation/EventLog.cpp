@@ -0,0 +1,223 @@
+/*
+* EventLog.cpp
+*
+* Class Description: A buffered text log written to a file descriptor,
+*					 optionally by a background writer thread.
+* Class Invariant: Text written is output in the order it was written.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include "EventLog.h"
+
+using namespace std;
+
+
+// Constructor; with "useBackground", a writer thread is started
+EventLog::EventLog(int logFileDescriptor, bool useBackground) {
+
+	fileDescriptor = logFileDescriptor;
+	background = useBackground;
+	failed = false;
+
+	buffer = new char[BUFFER_SIZE];
+	used = 0;
+	allocated = 1;
+	writing = false;
+	stopping = false;
+
+	if (background)
+		writer = thread(&EventLog::writeBuffers, this);
+}
+
+
+// Destructor; flushes the log and stops the writer thread
+EventLog::~EventLog() {
+
+	flush();
+
+	if (background) {
+		{
+			lock_guard<mutex> guard(lock);
+			stopping = true;
+		}
+		changed.notify_all();
+		writer.join();
+	}
+
+	delete [] buffer;
+	for (size_t i = 0; i < spare.size(); i++)
+		delete [] spare[i];
+}
+
+
+// Description: Writes "text".
+// Time Efficiency: O(length of text) amortized
+void EventLog::write(const char* text) {
+
+	int length = strlen(text);
+
+	// Text longer than a buffer is copied a buffer at a time
+	while (used + length > BUFFER_SIZE) {
+		int part = BUFFER_SIZE - used;
+
+		memcpy(buffer + used, text, part);
+		used += part;
+		text += part;
+		length -= part;
+		submit();
+	}
+
+	memcpy(buffer + used, text, length);
+	used += length;
+}
+
+
+// Description: Writes "value", right-aligned with spaces to at
+//				least "width" characters, as setw(width) would.
+// Precondition: width is at most 64.
+// Time Efficiency: O(1) amortized
+void EventLog::write(int value, int width) {
+
+	char digits[16];
+	int count = 0;
+
+	// Digits are produced last first; the magnitude is unsigned so
+	// that the smallest int does not overflow
+	unsigned int magnitude = (value < 0) ? 0u - (unsigned int)value : (unsigned int)value;
+
+	do {
+		digits[count++] = '0' + magnitude % 10;
+		magnitude /= 10;
+	} while (magnitude > 0);
+
+	if (value < 0)
+		digits[count++] = '-';
+
+	if (used + count + width > BUFFER_SIZE)
+		submit();
+
+	for (int i = count; i < width; i++)
+		buffer[used++] = ' ';
+	while (count > 0)
+		buffer[used++] = digits[--count];
+}
+
+
+// Description: Ends the line.
+// Time Efficiency: O(1) amortized
+void EventLog::endLine() {
+
+	if (used == BUFFER_SIZE)
+		submit();
+
+	buffer[used++] = '\n';
+}
+
+
+// Description: Returns once everything written has been written to
+//				the file, and returns "false" if any write failed.
+// Time Efficiency: O(bytes not yet written)
+bool EventLog::flush() {
+
+	if (used > 0)
+		submit();
+
+	if (background) {
+		unique_lock<mutex> guard(lock);
+		while (!full.empty() || writing)
+			changed.wait(guard);
+	}
+
+	return !failed;
+}
+
+
+// Description: Writes "length" bytes of "text" to the file and
+//				returns "false" if the write fails.
+// Time Efficiency: O(length)
+bool EventLog::writeFully(const char* text, int length) {
+
+	while (length > 0) {
+		ssize_t count = ::write(fileDescriptor, text, length);
+
+		if (count > 0) {
+			text += count;
+			length -= count;
+		}
+		else if (count < 0 && errno != EINTR)
+			return false;
+	}
+
+	return true;
+}
+
+
+// Description: Sends the current buffer to be written and starts a
+//				new one.
+// Time Efficiency: O(BUFFER_SIZE) if written here, otherwise O(1)
+//					unless the writer thread is MAX_BUFFERS behind
+void EventLog::submit() {
+
+	if (!background) {
+		if (!failed && !writeFully(buffer, used))
+			failed = true;
+		used = 0;
+		return;
+	}
+
+	unique_lock<mutex> guard(lock);
+
+	full.push_back(make_pair(buffer, used));
+	changed.notify_all();
+
+	// Reuse a written buffer, or allocate one; wait only if the writer
+	// thread holds every buffer there may be
+	while (spare.empty() && allocated == MAX_BUFFERS)
+		changed.wait(guard);
+
+	if (!spare.empty()) {
+		buffer = spare.back();
+		spare.pop_back();
+	}
+	else {
+		buffer = new char[BUFFER_SIZE];
+		allocated++;
+	}
+
+	used = 0;
+}
+
+
+// Description: The writer thread's loop, in background mode.
+void EventLog::writeBuffers() {
+
+	unique_lock<mutex> guard(lock);
+
+	while (true) {
+		while (full.empty() && !stopping)
+			changed.wait(guard);
+
+		if (full.empty())
+			return;
+
+		pair<char*, int> next = full.front();
+		full.pop_front();
+		writing = true;
+
+		// Write without holding the lock, so the event loop can go on
+		// filling buffers
+		guard.unlock();
+		bool written = failed || writeFully(next.first, next.second);
+		guard.lock();
+
+		if (!written)
+			failed = true;
+		spare.push_back(next.first);
+		writing = false;
+		changed.notify_all();
+	}
+}
@@ -0,0 +1,95 @@
+/*
+* EventLog.h
+*
+* Class Description: A buffered text log written to a file descriptor, for
+*					 narrating the simulation's events. Text is formatted
+*					 into a 64 KB buffer and written a buffer at a time,
+*					 never flushed line by line.
+*					 In background mode, full buffers are handed to a writer
+*					 thread, so the event loop does not wait on I/O; it only
+*					 waits if the writer falls MAX_BUFFERS buffers behind,
+*					 which bounds the memory held by the log.
+*					 Nothing written is guaranteed to have reached the file
+*					 until flush() returns.
+* Class Invariant: Text written is output in the order it was written.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+class EventLog {
+
+	private:
+		static const int BUFFER_SIZE = 1 << 16;		// Bytes in each buffer
+		static const int MAX_BUFFERS = 8;			// Most buffers allocated at once
+
+		int fileDescriptor;				// File the log is written to
+		bool background;				// Whether a writer thread does the writing
+		bool failed;					// Whether a write has failed
+
+		char* buffer;					// Buffer being filled
+		int used;						// Bytes used in "buffer"
+
+		thread writer;					// The writer thread, in background mode
+		mutex lock;						// Guards everything below
+		condition_variable changed;		// Signalled when anything below changes
+		deque< pair<char*, int> > full;	// Buffers waiting to be written, and their sizes
+		vector<char*> spare;			// Written buffers, ready to be filled again
+		int allocated;					// Number of buffers allocated
+		bool writing;					// Whether the writer thread is writing a buffer
+		bool stopping;					// Whether the writer thread should stop
+
+		// Logs own their file position and thread; they are not copied
+		EventLog(const EventLog& aLog);
+		EventLog& operator=(const EventLog& aLog);
+
+		// Description: Writes "length" bytes of "text" to the file and
+		//				returns "false" if the write fails.
+		// Time Efficiency: O(length)
+		bool writeFully(const char* text, int length);
+
+		// Description: Sends the current buffer to be written and starts a
+		//				new one.
+		// Time Efficiency: O(BUFFER_SIZE) if written here, otherwise O(1)
+		//					unless the writer thread is MAX_BUFFERS behind
+		void submit();
+
+		// Description: The writer thread's loop, in background mode.
+		void writeBuffers();
+
+	public:
+		// Constructor; with "useBackground", a writer thread is started
+		EventLog(int logFileDescriptor, bool useBackground = false);
+
+		// Destructor; flushes the log and stops the writer thread
+		~EventLog();
+
+		// Description: Writes "text".
+		// Time Efficiency: O(length of text) amortized
+		void write(const char* text);
+
+		// Description: Writes "value", right-aligned with spaces to at
+		//				least "width" characters, as setw(width) would.
+		// Precondition: width is at most 64.
+		// Time Efficiency: O(1) amortized
+		void write(int value, int width = 0);
+
+		// Description: Ends the line.
+		// Time Efficiency: O(1) amortized
+		void endLine();
+
+		// Description: Returns once everything written has been written to
+		//				the file, and returns "false" if any write failed.
+		// Time Efficiency: O(bytes not yet written)
+		bool flush();
+
+}; // end EventLog
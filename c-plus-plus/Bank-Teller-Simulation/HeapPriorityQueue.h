@@ -0,0 +1,355 @@
+/*
+* HeapPriorityQueue.h
+*
+* Class Description: A priority queue; elements at front have highest priority
+*					 and elements at back have lowest priority. Array-based
+*					 implementation using a 4-ary min-heap.
+* Class Invariant: Highest priority is defined as lowest element value. Each
+*				   element has priority no lower than its children in the
+*				   heap. Elements of equal value leave the queue in the
+*				   order they entered it (FIFO), as in PriorityQueue.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <iostream>
+#include <vector>
+#include "EmptyDataCollectionException.h"
+
+using namespace std;
+
+template <class ElementType>
+class HeapPriorityQueue {
+
+	private:
+		// An element and the order in which it was enqueued, used to
+		// break ties between equal elements
+		struct HeapEntry {
+			ElementType element;
+			unsigned long long sequence;
+		};
+
+		static const int ARITY = 4;			// Children per heap node
+
+		vector<HeapEntry> heap;				// Heap stored level by level
+		unsigned long long nextSequence;	// Sequence number of next enqueued element
+
+		// Description: Returns "true" if lhs must leave the queue before rhs.
+		// Time Efficiency: O(1)
+		static bool isBefore(const HeapEntry& lhs, const HeapEntry& rhs);
+
+		// Description: Moves the entry at index up until its parent is before it.
+		// Time Efficiency: O(log n)
+		void siftUp(int index);
+
+		// Description: Moves the entry at index down until it is before its children.
+		// Time Efficiency: O(log n)
+		void siftDown(int index);
+
+	public:
+		// Default constructor
+		HeapPriorityQueue();
+
+		// Range constructor; builds the heap from every element from "first"
+		// to "last" at once
+		// Time Efficiency: O(n)
+		template <class InputIterator>
+		HeapPriorityQueue(InputIterator first, InputIterator last);
+
+		/******* Public Interface - START - *******/
+
+		// Description: Returns the number of elements in the Priority Queue.
+		// (This method eases testing.)
+		// Time Efficiency: O(1)
+		int getElementCount() const;
+
+		// Description: Returns "true" is this Priority Queue is empty, otherwise "false".
+		// Time Efficiency: O(1)
+		bool isEmpty() const;
+
+		// Description: Inserts newElement in priority order.
+		//              It returns "true" if successful, otherwise "false".
+		// Postcondition: Once newElement is inserted, the heap invariant holds.
+		// Time Efficiency: O(log n)
+		bool enqueue(const ElementType& newElement);
+
+		// Description: Inserts every element from "first" to "last", in the
+		//				same order as enqueuing them one at a time would. The
+		//				new elements are appended and the heap rebuilt bottom
+		//				up, unless there are so few that sifting each up is
+		//				cheaper.
+		//              It returns "true" if successful, otherwise "false".
+		// Postcondition: The heap invariant holds.
+		// Time Efficiency: O(n + m) for m new elements, or O(m log n) if less
+		template <class InputIterator>
+		bool enqueueAll(InputIterator first, InputIterator last);
+
+		// Description: Removes the element with the "highest" priority.
+		//              It returns "true" if successful, otherwise "false".
+		// Precondition: This Priority Queue is not empty.
+		// Time Efficiency: O(log n)
+		bool dequeue();
+
+		// Description: Returns (a copy of) the element with the "highest" priority.
+		// Precondition: This Priority Queue is not empty.
+		// Postcondition: This Priority Queue is unchanged.
+		// Exceptions: Throws EmptyDataCollectionException if this Priority Queue is empty.
+		// Time Efficiency: O(1)
+		ElementType peek() const throw(EmptyDataCollectionException);
+
+		// Description: Prints the contents of the priority queue in priority order
+		// Postcondition: This Priority Queue is unchanged.
+		// Time Efficiency: O(n log n)
+		void printPriorityQueue();
+
+		// Description: Calls visit(element, rank) for every element, in no
+		//				particular order. Equal elements leave the queue in
+		//				the order of their ranks, so enqueuing every element
+		//				in rank order rebuilds this queue.
+		// Postcondition: This Priority Queue is unchanged.
+		// Time Efficiency: O(n)
+		template <class Visit>
+		void forEachEntry(Visit visit) const;
+
+		/******* Public Interface - END - *******/
+
+}; // end HeapPriorityQueue
+
+
+// Default constructor
+template <class ElementType>
+HeapPriorityQueue<ElementType>::HeapPriorityQueue() {
+	nextSequence = 0;
+}
+
+
+// Range constructor; builds the heap from every element from "first"
+// to "last" at once
+// Time Efficiency: O(n)
+template <class ElementType>
+template <class InputIterator>
+HeapPriorityQueue<ElementType>::HeapPriorityQueue(InputIterator first, InputIterator last) {
+	nextSequence = 0;
+	enqueueAll(first, last);
+}
+
+
+// Description: Returns the number of elements in the Priority Queue.
+// (This method eases testing.)
+// Time Efficiency: O(1)
+template <class ElementType>
+int HeapPriorityQueue<ElementType>::getElementCount() const {
+	return heap.size();
+}
+
+
+// Description: Returns "true" is this Priority Queue is empty, otherwise "false".
+// Time Efficiency: O(1)
+template <class ElementType>
+bool HeapPriorityQueue<ElementType>::isEmpty() const {
+	return heap.empty();
+}
+
+
+// Description: Inserts newElement in priority order.
+//              It returns "true" if successful, otherwise "false".
+// Postcondition: Once newElement is inserted, the heap invariant holds.
+// Time Efficiency: O(log n)
+template <class ElementType>
+bool HeapPriorityQueue<ElementType>::enqueue(const ElementType& newElement) {
+
+	HeapEntry entry;
+	entry.element = newElement;
+	entry.sequence = nextSequence++;
+
+	// Add the new entry as the last leaf and restore the heap above it
+	heap.push_back(entry);
+	siftUp(heap.size() - 1);
+
+	return true;
+}
+
+
+// Description: Inserts every element from "first" to "last", in the
+//				same order as enqueuing them one at a time would. The
+//				new elements are appended and the heap rebuilt bottom
+//				up, unless there are so few that sifting each up is
+//				cheaper.
+//              It returns "true" if successful, otherwise "false".
+// Postcondition: The heap invariant holds.
+// Time Efficiency: O(n + m) for m new elements, or O(m log n) if less
+template <class ElementType>
+template <class InputIterator>
+bool HeapPriorityQueue<ElementType>::enqueueAll(InputIterator first, InputIterator last) {
+
+	int start = heap.size();	// Index of the first new entry
+
+	// Sequence numbers are given in range order, so ties still leave first in, first out
+	for (; first != last; ++first) {
+		HeapEntry entry;
+		entry.element = *first;
+		entry.sequence = nextSequence++;
+		heap.push_back(entry);
+	}
+
+	int count = heap.size();
+	int added = count - start;
+	int levels = 0;				// Levels in the heap, the most a sift up climbs
+
+	if (added == 0)
+		return true;
+
+	for (int size = count; size > 0; size /= ARITY)
+		levels++;
+
+	if ((long long)added * levels < count) {
+		for (int i = start; i < count; i++)
+			siftUp(i);
+	}
+	else {
+		// Floyd's method: sift down every parent, last first; each level's
+		// subtrees are heaps before the level above is sifted
+		for (int i = (count - 2) / ARITY; i >= 0; i--)
+			siftDown(i);
+	}
+
+	return true;
+}
+
+
+// Description: Removes the element with the "highest" priority.
+//              It returns "true" if successful, otherwise "false".
+// Precondition: This Priority Queue is not empty.
+// Time Efficiency: O(log n)
+template <class ElementType>
+bool HeapPriorityQueue<ElementType>::dequeue() {
+
+	if (heap.empty())
+		return false;
+
+	// Move the last leaf into the root and restore the heap below it
+	heap[0] = heap.back();
+	heap.pop_back();
+	if (!heap.empty())
+		siftDown(0);
+
+	return true;
+}
+
+
+// Description: Returns (a copy of) the element with the "highest" priority.
+// Precondition: This Priority Queue is not empty.
+// Postcondition: This Priority Queue is unchanged.
+// Exceptions: Throws EmptyDataCollectionException if this Priority Queue is empty.
+// Time Efficiency: O(1)
+template <class ElementType>
+ElementType HeapPriorityQueue<ElementType>::peek() const throw(EmptyDataCollectionException) {
+
+	// Enforce precondition that queue is not empty
+	if (isEmpty())
+		throw EmptyDataCollectionException("peek() called with empty queue.");
+
+	return heap[0].element;
+}
+
+
+// Description: Prints the contents of the priority queue in priority order
+// Postcondition: This Priority Queue is unchanged.
+// Time Efficiency: O(n log n)
+template <class ElementType>
+void HeapPriorityQueue<ElementType>::printPriorityQueue() {
+
+	// The heap is only partially ordered; print from a copy in dequeue order
+	HeapPriorityQueue<ElementType> copy(*this);
+
+	if (copy.isEmpty())
+		cout << endl << "Priority queue is empty" << endl;
+
+	while (!copy.isEmpty()) {
+		cout << copy.peek();
+		copy.dequeue();
+	}
+}
+
+
+// Description: Calls visit(element, rank) for every element, in no
+//				particular order. Equal elements leave the queue in the
+//				order of their ranks, so enqueuing every element in rank
+//				order rebuilds this queue.
+// Postcondition: This Priority Queue is unchanged.
+// Time Efficiency: O(n)
+template <class ElementType>
+template <class Visit>
+void HeapPriorityQueue<ElementType>::forEachEntry(Visit visit) const {
+
+	// The sequence numbers already break ties
+	for (size_t i = 0; i < heap.size(); i++)
+		visit(heap[i].element, heap[i].sequence);
+}
+
+
+// Description: Returns "true" if lhs must leave the queue before rhs.
+// Time Efficiency: O(1)
+template <class ElementType>
+bool HeapPriorityQueue<ElementType>::isBefore(const HeapEntry& lhs, const HeapEntry& rhs) {
+
+	if (rhs.element > lhs.element)
+		return true;
+	if (lhs.element > rhs.element)
+		return false;
+
+	// Equal elements: first in, first out
+	return lhs.sequence < rhs.sequence;
+}
+
+
+// Description: Moves the entry at index up until its parent is before it.
+// Time Efficiency: O(log n)
+template <class ElementType>
+void HeapPriorityQueue<ElementType>::siftUp(int index) {
+
+	HeapEntry moving = heap[index];
+
+	// Shift parents down into the hole until the moving entry's place is found
+	while (index > 0) {
+		int parent = (index - 1) / ARITY;
+		if (!isBefore(moving, heap[parent]))
+			break;
+		heap[index] = heap[parent];
+		index = parent;
+	}
+
+	heap[index] = moving;
+}
+
+
+// Description: Moves the entry at index down until it is before its children.
+// Time Efficiency: O(log n)
+template <class ElementType>
+void HeapPriorityQueue<ElementType>::siftDown(int index) {
+
+	int count = heap.size();
+	HeapEntry moving = heap[index];
+
+	// Shift the earliest child up into the hole until the moving entry's place is found
+	while (true) {
+		int firstChild = index * ARITY + 1;
+		if (firstChild >= count)
+			break;
+
+		int lastChild = firstChild + ARITY < count ? firstChild + ARITY : count;
+		int earliest = firstChild;
+		for (int child = firstChild + 1; child < lastChild; child++) {
+			if (isBefore(heap[child], heap[earliest]))
+				earliest = child;
+		}
+
+		if (!isBefore(heap[earliest], moving))
+			break;
+		heap[index] = heap[earliest];
+		index = earliest;
+	}
+
+	heap[index] = moving;
+}
@@ -0,0 +1,394 @@
+/*
+* IndexedHeapPriorityQueue.h
+*
+* Class Description: A priority queue whose elements can be reached after
+*					 they are enqueued: enqueue returns a handle, with which
+*					 the element can be cancelled (removed wherever it is in
+*					 the queue) or moved earlier with decreaseKey, each in
+*					 O(log n). Array-based 4-ary min-heap, as in
+*					 HeapPriorityQueue, plus a table from handles to heap
+*					 positions kept up to date as entries move.
+*					 A handle stays valid until its element is dequeued or
+*					 cancelled; it may then be given to a later element.
+* Class Invariant: Highest priority is defined as lowest element value. Each
+*				   element has priority no lower than its children in the
+*				   heap. Elements of equal value leave the queue in the
+*				   order they entered it (FIFO). positions[heap[i].handle]
+*				   is i for every entry of the heap.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <iostream>
+#include <vector>
+#include "EmptyDataCollectionException.h"
+
+using namespace std;
+
+template <class ElementType>
+class IndexedHeapPriorityQueue {
+
+	private:
+		// An element, the order in which it was enqueued, used to break
+		// ties between equal elements, and its handle
+		struct HeapEntry {
+			ElementType element;
+			unsigned long long sequence;
+			int handle;
+		};
+
+		static const int ARITY = 4;			// Children per heap node
+		static const int NO_POSITION = -1;	// Position of a handle not in use
+
+		vector<HeapEntry> heap;				// Heap stored level by level
+		vector<int> positions;				// Heap index of each handle's entry
+		vector<int> freeHandles;			// Handles not in use
+		unsigned long long nextSequence;	// Sequence number of next enqueued element
+
+		// Description: Returns "true" if lhs must leave the queue before rhs.
+		// Time Efficiency: O(1)
+		static bool isBefore(const HeapEntry& lhs, const HeapEntry& rhs);
+
+		// Description: Puts "entry" at index and records its position.
+		// Time Efficiency: O(1)
+		void place(int index, const HeapEntry& entry);
+
+		// Description: Removes the entry at index, filling its place with
+		//				the last leaf, and frees its handle.
+		// Time Efficiency: O(log n)
+		void removeAt(int index);
+
+		// Description: Moves the entry at index up until its parent is before it.
+		// Time Efficiency: O(log n)
+		void siftUp(int index);
+
+		// Description: Moves the entry at index down until it is before its children.
+		// Time Efficiency: O(log n)
+		void siftDown(int index);
+
+	public:
+		// Default constructor
+		IndexedHeapPriorityQueue();
+
+		/******* Public Interface - START - *******/
+
+		// Description: Returns the number of elements in the Priority Queue.
+		// (This method eases testing.)
+		// Time Efficiency: O(1)
+		int getElementCount() const;
+
+		// Description: Returns "true" is this Priority Queue is empty, otherwise "false".
+		// Time Efficiency: O(1)
+		bool isEmpty() const;
+
+		// Description: Inserts newElement in priority order and returns its
+		//				handle.
+		// Postcondition: Once newElement is inserted, the heap invariant holds.
+		// Time Efficiency: O(log n), amortized over the growth of the arrays
+		int enqueue(const ElementType& newElement);
+
+		// Description: Removes the element with the "highest" priority.
+		//              It returns "true" if successful, otherwise "false".
+		// Precondition: This Priority Queue is not empty.
+		// Time Efficiency: O(log n)
+		bool dequeue();
+
+		// Description: Returns (a copy of) the element with the "highest" priority.
+		// Precondition: This Priority Queue is not empty.
+		// Postcondition: This Priority Queue is unchanged.
+		// Exceptions: Throws EmptyDataCollectionException if this Priority Queue is empty.
+		// Time Efficiency: O(1)
+		ElementType peek() const throw(EmptyDataCollectionException);
+
+		// Description: Returns the handle of the element with the "highest"
+		//				priority.
+		// Precondition: This Priority Queue is not empty.
+		// Postcondition: This Priority Queue is unchanged.
+		// Exceptions: Throws EmptyDataCollectionException if this Priority Queue is empty.
+		// Time Efficiency: O(1)
+		int peekHandle() const throw(EmptyDataCollectionException);
+
+		// Description: Returns "true" if "handle" belongs to an element in
+		//				this Priority Queue.
+		// Time Efficiency: O(1)
+		bool contains(int handle) const;
+
+		// Description: Removes the element with the given handle, wherever it
+		//				is in the queue.
+		//              It returns "true" if successful, or "false" if the
+		//				handle does not belong to an element in the queue.
+		// Postcondition: The handle may be given to a later element.
+		// Time Efficiency: O(log n)
+		bool cancel(int handle);
+
+		// Description: Replaces the element with the given handle by
+		//				newElement, which must not be later than it. Among
+		//				equal elements it keeps its place from its first
+		//				enqueue.
+		//              It returns "true" if successful, or "false" if the
+		//				handle does not belong to an element in the queue or
+		//				newElement is later than the element.
+		// Time Efficiency: O(log n)
+		bool decreaseKey(int handle, const ElementType& newElement);
+
+		/******* Public Interface - END - *******/
+
+}; // end IndexedHeapPriorityQueue
+
+
+// Default constructor
+template <class ElementType>
+IndexedHeapPriorityQueue<ElementType>::IndexedHeapPriorityQueue() {
+	nextSequence = 0;
+}
+
+
+// Description: Returns the number of elements in the Priority Queue.
+// (This method eases testing.)
+// Time Efficiency: O(1)
+template <class ElementType>
+int IndexedHeapPriorityQueue<ElementType>::getElementCount() const {
+	return heap.size();
+}
+
+
+// Description: Returns "true" is this Priority Queue is empty, otherwise "false".
+// Time Efficiency: O(1)
+template <class ElementType>
+bool IndexedHeapPriorityQueue<ElementType>::isEmpty() const {
+	return heap.empty();
+}
+
+
+// Description: Inserts newElement in priority order and returns its
+//				handle.
+// Postcondition: Once newElement is inserted, the heap invariant holds.
+// Time Efficiency: O(log n), amortized over the growth of the arrays
+template <class ElementType>
+int IndexedHeapPriorityQueue<ElementType>::enqueue(const ElementType& newElement) {
+
+	HeapEntry entry;
+	entry.element = newElement;
+	entry.sequence = nextSequence++;
+
+	// Reuse a freed handle before making a new one
+	if (!freeHandles.empty()) {
+		entry.handle = freeHandles.back();
+		freeHandles.pop_back();
+	}
+	else {
+		entry.handle = positions.size();
+		positions.push_back(0);
+	}
+
+	// Add the new entry as the last leaf and restore the heap above it
+	heap.push_back(entry);
+	positions[entry.handle] = heap.size() - 1;
+	siftUp(heap.size() - 1);
+
+	return entry.handle;
+}
+
+
+// Description: Removes the element with the "highest" priority.
+//              It returns "true" if successful, otherwise "false".
+// Precondition: This Priority Queue is not empty.
+// Time Efficiency: O(log n)
+template <class ElementType>
+bool IndexedHeapPriorityQueue<ElementType>::dequeue() {
+
+	if (heap.empty())
+		return false;
+
+	removeAt(0);
+	return true;
+}
+
+
+// Description: Returns (a copy of) the element with the "highest" priority.
+// Precondition: This Priority Queue is not empty.
+// Postcondition: This Priority Queue is unchanged.
+// Exceptions: Throws EmptyDataCollectionException if this Priority Queue is empty.
+// Time Efficiency: O(1)
+template <class ElementType>
+ElementType IndexedHeapPriorityQueue<ElementType>::peek() const throw(EmptyDataCollectionException) {
+
+	// Enforce precondition that queue is not empty
+	if (isEmpty())
+		throw EmptyDataCollectionException("peek() called with empty queue.");
+
+	return heap[0].element;
+}
+
+
+// Description: Returns the handle of the element with the "highest"
+//				priority.
+// Precondition: This Priority Queue is not empty.
+// Postcondition: This Priority Queue is unchanged.
+// Exceptions: Throws EmptyDataCollectionException if this Priority Queue is empty.
+// Time Efficiency: O(1)
+template <class ElementType>
+int IndexedHeapPriorityQueue<ElementType>::peekHandle() const throw(EmptyDataCollectionException) {
+
+	// Enforce precondition that queue is not empty
+	if (isEmpty())
+		throw EmptyDataCollectionException("peekHandle() called with empty queue.");
+
+	return heap[0].handle;
+}
+
+
+// Description: Returns "true" if "handle" belongs to an element in
+//				this Priority Queue.
+// Time Efficiency: O(1)
+template <class ElementType>
+bool IndexedHeapPriorityQueue<ElementType>::contains(int handle) const {
+	return handle >= 0 && handle < (int)positions.size() && positions[handle] != NO_POSITION;
+}
+
+
+// Description: Removes the element with the given handle, wherever it
+//				is in the queue.
+//              It returns "true" if successful, or "false" if the
+//				handle does not belong to an element in the queue.
+// Postcondition: The handle may be given to a later element.
+// Time Efficiency: O(log n)
+template <class ElementType>
+bool IndexedHeapPriorityQueue<ElementType>::cancel(int handle) {
+
+	if (!contains(handle))
+		return false;
+
+	removeAt(positions[handle]);
+	return true;
+}
+
+
+// Description: Replaces the element with the given handle by
+//				newElement, which must not be later than it. Among
+//				equal elements it keeps its place from its first
+//				enqueue.
+//              It returns "true" if successful, or "false" if the
+//				handle does not belong to an element in the queue or
+//				newElement is later than the element.
+// Time Efficiency: O(log n)
+template <class ElementType>
+bool IndexedHeapPriorityQueue<ElementType>::decreaseKey(int handle, const ElementType& newElement) {
+
+	if (!contains(handle))
+		return false;
+
+	int index = positions[handle];
+	if (newElement > heap[index].element)
+		return false;
+
+	// An earlier element can only need to move up
+	heap[index].element = newElement;
+	siftUp(index);
+
+	return true;
+}
+
+
+// Description: Returns "true" if lhs must leave the queue before rhs.
+// Time Efficiency: O(1)
+template <class ElementType>
+bool IndexedHeapPriorityQueue<ElementType>::isBefore(const HeapEntry& lhs, const HeapEntry& rhs) {
+
+	if (rhs.element > lhs.element)
+		return true;
+	if (lhs.element > rhs.element)
+		return false;
+
+	// Equal elements: first in, first out
+	return lhs.sequence < rhs.sequence;
+}
+
+
+// Description: Puts "entry" at index and records its position.
+// Time Efficiency: O(1)
+template <class ElementType>
+void IndexedHeapPriorityQueue<ElementType>::place(int index, const HeapEntry& entry) {
+	heap[index] = entry;
+	positions[entry.handle] = index;
+}
+
+
+// Description: Removes the entry at index, filling its place with
+//				the last leaf, and frees its handle.
+// Time Efficiency: O(log n)
+template <class ElementType>
+void IndexedHeapPriorityQueue<ElementType>::removeAt(int index) {
+
+	int handle = heap[index].handle;
+	int last = heap.size() - 1;
+
+	positions[handle] = NO_POSITION;
+	freeHandles.push_back(handle);
+
+	if (index == last) {
+		heap.pop_back();
+		return;
+	}
+
+	// The last leaf may belong above or below the removed entry's place
+	place(index, heap[last]);
+	heap.pop_back();
+
+	if (index > 0 && isBefore(heap[index], heap[(index - 1) / ARITY]))
+		siftUp(index);
+	else
+		siftDown(index);
+}
+
+
+// Description: Moves the entry at index up until its parent is before it.
+// Time Efficiency: O(log n)
+template <class ElementType>
+void IndexedHeapPriorityQueue<ElementType>::siftUp(int index) {
+
+	HeapEntry moving = heap[index];
+
+	// Shift parents down into the hole until the moving entry's place is found
+	while (index > 0) {
+		int parent = (index - 1) / ARITY;
+		if (!isBefore(moving, heap[parent]))
+			break;
+		place(index, heap[parent]);
+		index = parent;
+	}
+
+	place(index, moving);
+}
+
+
+// Description: Moves the entry at index down until it is before its children.
+// Time Efficiency: O(log n)
+template <class ElementType>
+void IndexedHeapPriorityQueue<ElementType>::siftDown(int index) {
+
+	int count = heap.size();
+	HeapEntry moving = heap[index];
+
+	// Shift the earliest child up into the hole until the moving entry's place is found
+	while (true) {
+		int firstChild = index * ARITY + 1;
+		if (firstChild >= count)
+			break;
+
+		int lastChild = firstChild + ARITY < count ? firstChild + ARITY : count;
+		int earliest = firstChild;
+		for (int child = firstChild + 1; child < lastChild; child++) {
+			if (isBefore(heap[child], heap[earliest]))
+				earliest = child;
+		}
+
+		if (!isBefore(heap[earliest], moving))
+			break;
+		place(index, heap[earliest]);
+		index = earliest;
+	}
+
+	place(index, moving);
+}
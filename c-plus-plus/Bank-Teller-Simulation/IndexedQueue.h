@@ -0,0 +1,312 @@
+/*
+* IndexedQueue.h
+*
+* Class Description: A queue whose elements can also leave from the middle:
+*					 enqueue returns a handle, with which the element can be
+*					 read, changed or removed wherever it is in the queue,
+*					 in O(1). Elements are kept in an array of slots linked
+*					 front to back in both directions; freed slots are
+*					 linked into a free list and reused, so the array only
+*					 grows to the most elements the queue has held at once.
+*					 A handle stays valid until its element is dequeued or
+*					 removed; it may then be given to a later element.
+*					 Moving a queue hands over its slots; the moved-from
+*					 queue is empty.
+* Class Invariant: FIFO/LILO. Elements added to back of queue and removed
+*				   from front, or from anywhere with their handle. A slot
+*				   is in use exactly when its "previous" is not FREE_SLOT.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "EmptyDataCollectionException.h"
+
+using namespace std;
+
+template <class ElementType>
+class IndexedQueue {
+
+	private:
+		// An element and its neighbours in the queue, or a free slot
+		struct Slot {
+			ElementType element;
+			int previous;		// Slot of the element ahead, NO_SLOT at the front, or FREE_SLOT
+			int next;			// Slot of the element behind, or the next free slot
+		};
+
+		static const int NO_SLOT = -1;		// End of a list of slots
+		static const int FREE_SLOT = -2;	// "previous" of a slot not in use
+
+		vector<Slot> slots;		// Every slot, in use or free
+		int front;				// Slot of front of queue, or NO_SLOT
+		int back;				// Slot of back of queue, or NO_SLOT
+		int firstFree;			// First slot of the free list, or NO_SLOT
+		int elementCount;		// Element count
+
+		// Description: Unlinks the slot "handle" and puts it on the free list.
+		// Precondition: contains(handle) is "true".
+		// Time Efficiency: O(1)
+		void unlink(int handle);
+
+	public:
+		// Constructor
+		IndexedQueue();
+
+		// Copy constructor and assignment operator copy every slot, so
+		// handles stay valid in the copy
+		IndexedQueue(const IndexedQueue<ElementType>& aQueue) = default;
+		IndexedQueue<ElementType>& operator=(const IndexedQueue<ElementType>& aQueue) = default;
+
+		// Move constructor; "aQueue" is left empty
+		IndexedQueue(IndexedQueue<ElementType>&& aQueue);
+
+		// Move assignment operator; "aQueue" is left with this queue's old elements
+		IndexedQueue<ElementType>& operator=(IndexedQueue<ElementType>&& aQueue);
+
+		/******* Public Interface - START - *******/
+
+		// Description: Returns the number of elements in the Queue.
+		// (This method eases testing.)
+		// Time Efficiency: O(1)
+		int getElementCount() const;
+
+		// Description: Returns "true" is this Queue is empty, otherwise "false".
+		// Time Efficiency: O(1)
+		bool isEmpty() const;
+
+		// Description: Adds newElement to the "back" of this Queue and
+		//				returns its handle.
+		// Time Efficiency: O(1) amortized
+		int enqueue(const ElementType& newElement);
+
+		// Description: Removes the element at the "front" of this Queue and
+		//              returns "true" if successful, otherwise "false".
+		// Precondition: This Queue is not empty.
+		// Time Efficiency: O(1)
+		bool dequeue();
+
+		// Description: Returns (a copy of) the element located at the "front" of this Queue.
+		// Precondition: This Queue is not empty.
+		// Postcondition: This Queue is unchanged.
+		// Exceptions: Throws EmptyDataCollectionException if this Queue is empty.
+		// Time Efficiency: O(1)
+		ElementType peek() const throw(EmptyDataCollectionException);
+
+		// Description: Returns "true" if "handle" belongs to an element in
+		//				this Queue.
+		// Time Efficiency: O(1)
+		bool contains(int handle) const;
+
+		// Description: Returns the element with the given handle, which may
+		//				be changed in place.
+		// Precondition: contains(handle) is "true".
+		// Time Efficiency: O(1)
+		ElementType& get(int handle);
+
+		// Description: Removes the element with the given handle, wherever it
+		//				is in the queue; the others keep their order.
+		//              It returns "true" if successful, or "false" if the
+		//				handle does not belong to an element in the queue.
+		// Postcondition: The handle may be given to a later element.
+		// Time Efficiency: O(1)
+		bool remove(int handle);
+
+		/******* Public Interface - END - *******/
+
+}; // end IndexedQueue
+
+
+// Constructor
+template <class ElementType>
+IndexedQueue<ElementType>::IndexedQueue() {
+	front = NO_SLOT;
+	back = NO_SLOT;
+	firstFree = NO_SLOT;
+	elementCount = 0;
+}
+
+
+// Move constructor; "aQueue" is left empty
+template <class ElementType>
+IndexedQueue<ElementType>::IndexedQueue(IndexedQueue<ElementType>&& aQueue) {
+
+	// The slots change owner; their elements are not copied
+	slots.swap(aQueue.slots);
+	front = aQueue.front;
+	back = aQueue.back;
+	firstFree = aQueue.firstFree;
+	elementCount = aQueue.elementCount;
+
+	aQueue.front = NO_SLOT;
+	aQueue.back = NO_SLOT;
+	aQueue.firstFree = NO_SLOT;
+	aQueue.elementCount = 0;
+}
+
+
+// Move assignment operator; "aQueue" is left with this queue's old elements
+template <class ElementType>
+IndexedQueue<ElementType>& IndexedQueue<ElementType>::operator=(IndexedQueue<ElementType>&& aQueue) {
+
+	if (this != &aQueue) {
+		slots.swap(aQueue.slots);
+		swap(front, aQueue.front);
+		swap(back, aQueue.back);
+		swap(firstFree, aQueue.firstFree);
+		swap(elementCount, aQueue.elementCount);
+	}
+
+	return *this;
+}
+
+
+// Description: Returns the number of elements in the Queue.
+// (This method eases testing.)
+// Time Efficiency: O(1)
+template <class ElementType>
+int IndexedQueue<ElementType>::getElementCount() const {
+	return elementCount;
+}
+
+
+// Description: Returns "true" is this Queue is empty, otherwise "false".
+// Time Efficiency: O(1)
+template <class ElementType>
+bool IndexedQueue<ElementType>::isEmpty() const {
+	return elementCount == 0;
+}
+
+
+// Description: Adds newElement to the "back" of this Queue and
+//				returns its handle.
+// Time Efficiency: O(1) amortized
+template <class ElementType>
+int IndexedQueue<ElementType>::enqueue(const ElementType& newElement) {
+
+	int slot;
+
+	// Take a free slot if there is one; otherwise the array grows by one
+	if (firstFree != NO_SLOT) {
+		slot = firstFree;
+		firstFree = slots[slot].next;
+	}
+	else {
+		slot = slots.size();
+		slots.push_back(Slot());
+	}
+
+	// Link the slot in at the back
+	slots[slot].element = newElement;
+	slots[slot].previous = back;
+	slots[slot].next = NO_SLOT;
+
+	if (back != NO_SLOT)
+		slots[back].next = slot;
+	else
+		front = slot;
+	back = slot;
+	elementCount++;
+
+	return slot;
+}
+
+
+// Description: Removes the element at the "front" of this Queue and
+//              returns "true" if successful, otherwise "false".
+// Precondition: This Queue is not empty.
+// Time Efficiency: O(1)
+template <class ElementType>
+bool IndexedQueue<ElementType>::dequeue() {
+
+	// Enforce precondition that queue is not empty
+	if (isEmpty())
+		return false;
+
+	// The front slot is in use; no need to check it as remove() does
+	unlink(front);
+	return true;
+}
+
+
+// Description: Returns (a copy of) the element located at the "front" of this Queue.
+// Precondition: This Queue is not empty.
+// Postcondition: This Queue is unchanged.
+// Exceptions: Throws EmptyDataCollectionException if this Queue is empty.
+// Time Efficiency: O(1)
+template <class ElementType>
+ElementType IndexedQueue<ElementType>::peek() const throw(EmptyDataCollectionException) {
+
+	// Enforce precondition that queue is not empty
+	if (isEmpty())
+		throw EmptyDataCollectionException("peek() called with empty queue.");
+
+	return slots[front].element;
+}
+
+
+// Description: Returns "true" if "handle" belongs to an element in
+//				this Queue.
+// Time Efficiency: O(1)
+template <class ElementType>
+bool IndexedQueue<ElementType>::contains(int handle) const {
+	return handle >= 0 && handle < (int)slots.size() && slots[handle].previous != FREE_SLOT;
+}
+
+
+// Description: Returns the element with the given handle, which may
+//				be changed in place.
+// Precondition: contains(handle) is "true".
+// Time Efficiency: O(1)
+template <class ElementType>
+ElementType& IndexedQueue<ElementType>::get(int handle) {
+	return slots[handle].element;
+}
+
+
+// Description: Removes the element with the given handle, wherever it
+//				is in the queue; the others keep their order.
+//              It returns "true" if successful, or "false" if the
+//				handle does not belong to an element in the queue.
+// Postcondition: The handle may be given to a later element.
+// Time Efficiency: O(1)
+template <class ElementType>
+bool IndexedQueue<ElementType>::remove(int handle) {
+
+	if (!contains(handle))
+		return false;
+
+	unlink(handle);
+	return true;
+}
+
+
+// Description: Unlinks the slot "handle" and puts it on the free list.
+// Precondition: contains(handle) is "true".
+// Time Efficiency: O(1)
+template <class ElementType>
+void IndexedQueue<ElementType>::unlink(int handle) {
+
+	Slot& slot = slots[handle];
+
+	// Link the neighbours to each other around the slot
+	if (slot.previous != NO_SLOT)
+		slots[slot.previous].next = slot.next;
+	else
+		front = slot.next;
+
+	if (slot.next != NO_SLOT)
+		slots[slot.next].previous = slot.previous;
+	else
+		back = slot.previous;
+
+	// Release the element's resources and put the slot on the free list
+	slot.element = ElementType();
+	slot.previous = FREE_SLOT;
+	slot.next = firstFree;
+	firstFree = handle;
+	elementCount--;
+}
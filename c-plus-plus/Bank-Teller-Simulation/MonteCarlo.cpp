@@ -0,0 +1,119 @@
+/*
+* MonteCarlo.cpp
+*
+* Class Description: Runs independent replications of the bank simulation
+*					 on generated arrivals, in parallel, and summarizes the
+*					 average waiting time across them.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "MonteCarlo.h"
+#include "HeapPriorityQueue.h"
+#include "WorkStealingPool.h"
+
+using namespace std;
+
+
+// Two-sided 95% critical values of Student's t distribution for 1 to 30
+// degrees of freedom; the normal value is used beyond that
+static const double T_CRITICAL_95[] = {
+	12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+	2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+	2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+};
+static const double Z_CRITICAL_95 = 1.960;
+
+
+// Description: Runs "replications" simulations of "customers" customers each,
+//				drawn from "generator", with the given tellers, line policy
+//				and customer behavior, on "threads" threads (or one per
+//				core if threads is 0). Each replication seeds the
+//				behavior from its own stream, in place of behavior.seed.
+//				A replication stops if a time would pass INT_MAX, and the
+//				result then says so.
+// Precondition: replications and customers are positive. behavior is
+//				 valid for BankSimulation::setBehavior().
+// Time Efficiency: O(replications * customers * log customers / threads)
+MonteCarloResult runReplications(const ArrivalGenerator& generator, int replications, int customers,
+	int tellers, LinePolicy linePolicy, const CustomerBehavior& behavior, unsigned long long seed,
+	int threads) {
+
+	vector<double> averageWaits(replications);
+	vector<long long> reneged(replications);
+	vector<long long> balked(replications);
+	atomic<bool> timesOverflowed(false);
+	WorkStealingPool pool(threads);
+
+	// Each worker reuses one engine for every replication it runs
+	vector< BankSimulation< HeapPriorityQueue<Event> > > simulations(pool.getThreadCount(),
+		BankSimulation< HeapPriorityQueue<Event> >(tellers, linePolicy));
+
+	// Each replication writes only its own average, so they need no locking
+	pool.run(replications, [&](int worker, int replication) {
+
+		// Each replication has its own stream, whichever thread runs it
+		seed_seq streamSeed = { (unsigned int)seed, (unsigned int)(seed >> 32),
+			(unsigned int)replication };
+		mt19937_64 randomEngine(streamSeed);
+		HeapPriorityQueue<Event> eventPriorityQueue;
+		BankSimulation< HeapPriorityQueue<Event> >& simulation = simulations[worker];
+		CustomerBehavior replicationBehavior = behavior;
+
+		if (!generator.generate(eventPriorityQueue, customers, randomEngine)) {
+			timesOverflowed = true;
+			return;
+		}
+
+		// Drawn after the arrivals, so they are the same with or without it
+		replicationBehavior.seed = randomEngine();
+		simulation.setBehavior(replicationBehavior);
+		simulation.run(std::move(eventPriorityQueue));
+		if (simulation.getDeparturesRejected() > 0)
+			timesOverflowed = true;
+		averageWaits[replication] = simulation.getAverageWait();
+		reneged[replication] = simulation.getStatistics().getCustomersReneged();
+		balked[replication] = simulation.getStatistics().getCustomersBalked();
+	});
+
+	// Summarize in replication order, so the result is the same on any
+	// number of threads
+	MonteCarloResult result;
+	double sum = 0.0;
+	double squaredDeviations = 0.0;
+
+	double renegedSum = 0.0;
+	double balkedSum = 0.0;
+
+	for (int i = 0; i < replications; i++) {
+		sum += averageWaits[i];
+		renegedSum += reneged[i];
+		balkedSum += balked[i];
+	}
+	result.replications = replications;
+	result.meanReneged = renegedSum / replications;
+	result.meanBalked = balkedSum / replications;
+	result.timesOverflowed = timesOverflowed;
+	result.meanWait = sum / replications;
+
+	for (int i = 0; i < replications; i++)
+		squaredDeviations += (averageWaits[i] - result.meanWait) * (averageWaits[i] - result.meanWait);
+
+	if (replications > 1) {
+		int degreesOfFreedom = replications - 1;
+		double critical = (degreesOfFreedom <= 30) ? T_CRITICAL_95[degreesOfFreedom - 1] : Z_CRITICAL_95;
+
+		result.standardDeviation = sqrt(squaredDeviations / degreesOfFreedom);
+		result.halfWidth = critical * result.standardDeviation / sqrt((double)replications);
+	}
+	else {
+		result.standardDeviation = 0.0;
+		result.halfWidth = 0.0;
+	}
+
+	return result;
+}
@@ -0,0 +1,48 @@
+/*
+* MonteCarlo.h
+*
+* Class Description: Runs independent replications of the bank simulation
+*					 on generated arrivals, in parallel, and summarizes the
+*					 average waiting time across them.
+*					 Replications are spread over a WorkStealingPool, and
+*					 each worker thread owns its event queue and simulation
+*					 engine. Replication r draws its arrivals from its own
+*					 random number stream, seeded from the run's seed and r,
+*					 so the results do not depend on the number of threads
+*					 or on which thread ran which replication.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include "ArrivalGenerator.h"
+#include "BankSimulation.h"
+
+using namespace std;
+
+// Summary of a set of replications
+struct MonteCarloResult {
+	int replications;			// Number of replications run
+	double meanWait;			// Mean over replications of the average waiting time
+	double standardDeviation;	// Sample standard deviation of the average waiting times
+	double halfWidth;			// Half-width of the 95% confidence interval for meanWait
+	double meanReneged;			// Mean over replications of the customers who gave up waiting
+	double meanBalked;			// Mean over replications of the customers who would not join a line
+	bool timesOverflowed;		// A replication's times would have passed INT_MAX, so the
+								// rest of the result is meaningless
+};
+
+
+// Description: Runs "replications" simulations of "customers" customers each,
+//				drawn from "generator", with the given tellers, line policy
+//				and customer behavior, on "threads" threads (or one per
+//				core if threads is 0). Each replication seeds the
+//				behavior from its own stream, in place of behavior.seed.
+//				A replication stops if a time would pass INT_MAX, and the
+//				result then says so.
+// Precondition: replications and customers are positive. behavior is
+//				 valid for BankSimulation::setBehavior().
+// Time Efficiency: O(replications * customers * log customers / threads)
+MonteCarloResult runReplications(const ArrivalGenerator& generator, int replications, int customers,
+	int tellers, LinePolicy linePolicy, const CustomerBehavior& behavior, unsigned long long seed,
+	int threads);
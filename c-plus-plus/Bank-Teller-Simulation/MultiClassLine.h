@@ -0,0 +1,278 @@
+/*
+* MultiClassLine.h
+*
+* Class Description: A line of customers in priority classes: class 0 is
+*					 served first, then class 1, and so on, and within a
+*					 class customers are served in the order they joined.
+*					 Each class has its own queue in a small fixed array,
+*					 and a bitmask records which classes have anyone
+*					 waiting, so the highest non-empty class is found with
+*					 one count-trailing-zeros instruction, and enqueue,
+*					 dequeue and peek are all O(1) whatever the number of
+*					 customers waiting.
+*					 The class queues are IndexedQueues, so a customer can
+*					 also leave from the middle of the line: enqueue returns
+*					 a handle for the customer, made of their handle in
+*					 their class's queue and their class, that remove()
+*					 takes. Moving a line hands over its queues; the
+*					 moved-from line is empty.
+* Class Invariant: Bit c of "occupied" is set exactly when the queue of
+*				   class c is not empty. CLASS_COUNT is between 1 and 32.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <iostream>
+#include <utility>
+#include "IndexedQueue.h"
+#include "EmptyDataCollectionException.h"
+
+using namespace std;
+
+template <class ElementType, int CLASS_COUNT>
+class MultiClassLine {
+
+	private:
+		IndexedQueue<ElementType> classQueues[CLASS_COUNT];	// Customers waiting in each class
+		unsigned int occupied;			// Bit c is set if class c has customers waiting
+		int elementCount;				// Customers waiting in every class
+
+		// Description: Returns the highest-priority class with customers waiting.
+		// Precondition: This line is not empty.
+		// Time Efficiency: O(1)
+		int firstOccupiedClass() const;
+
+	public:
+		// Constructor
+		MultiClassLine();
+
+		// Copy constructor and assignment operator copy every class's queue
+		MultiClassLine(const MultiClassLine<ElementType, CLASS_COUNT>& aLine) = default;
+		MultiClassLine<ElementType, CLASS_COUNT>& operator=(const MultiClassLine<ElementType, CLASS_COUNT>& aLine) = default;
+
+		// Move constructor; "aLine" is left empty
+		MultiClassLine(MultiClassLine<ElementType, CLASS_COUNT>&& aLine);
+
+		// Move assignment operator; "aLine" is left with this line's old elements
+		MultiClassLine<ElementType, CLASS_COUNT>& operator=(MultiClassLine<ElementType, CLASS_COUNT>&& aLine);
+
+		/******* Public Interface - START - *******/
+
+		// Description: Returns the number of elements in the line, in every class.
+		// Time Efficiency: O(1)
+		int getElementCount() const;
+
+		// Description: Returns the number of elements of class "customerClass".
+		// Precondition: customerClass is between 0 and CLASS_COUNT - 1.
+		// Time Efficiency: O(1)
+		int getElementCount(int customerClass) const;
+
+		// Description: Returns "true" is this line is empty, otherwise "false".
+		// Time Efficiency: O(1)
+		bool isEmpty() const;
+
+		// Description: Adds newElement to the back of its class and returns
+		//				its handle.
+		// Precondition: customerClass is between 0 and CLASS_COUNT - 1.
+		// Time Efficiency: O(1) amortized
+		int enqueue(const ElementType& newElement, int customerClass);
+
+		// Description: Removes the front element of the highest-priority class
+		//				with elements, and returns "true" if successful,
+		//				otherwise "false".
+		// Precondition: This line is not empty.
+		// Time Efficiency: O(1)
+		bool dequeue();
+
+		// Description: Returns (a copy of) the front element of the
+		//				highest-priority class with elements.
+		// Precondition: This line is not empty.
+		// Postcondition: This line is unchanged.
+		// Exceptions: Throws EmptyDataCollectionException if this line is empty.
+		// Time Efficiency: O(1)
+		ElementType peek() const throw(EmptyDataCollectionException);
+
+		// Description: Returns the element with the given handle, which may
+		//				be changed in place.
+		// Precondition: The handle belongs to an element in this line.
+		// Time Efficiency: O(1)
+		ElementType& get(int handle);
+
+		// Description: Removes the element with the given handle, wherever it
+		//				is in the line; the others keep their order.
+		//              It returns "true" if successful, or "false" if the
+		//				handle does not belong to an element in the line.
+		// Postcondition: The handle may be given to a later element.
+		// Time Efficiency: O(1)
+		bool remove(int handle);
+
+		/******* Public Interface - END - *******/
+
+}; // end MultiClassLine
+
+
+// Constructor
+template <class ElementType, int CLASS_COUNT>
+MultiClassLine<ElementType, CLASS_COUNT>::MultiClassLine() {
+	static_assert(CLASS_COUNT >= 1 && CLASS_COUNT <= 32, "The occupancy mask holds at most 32 classes");
+
+	occupied = 0;
+	elementCount = 0;
+}
+
+
+// Move constructor; "aLine" is left empty
+template <class ElementType, int CLASS_COUNT>
+MultiClassLine<ElementType, CLASS_COUNT>::MultiClassLine(MultiClassLine<ElementType, CLASS_COUNT>&& aLine) {
+
+	for (int i = 0; i < CLASS_COUNT; i++)
+		classQueues[i] = std::move(aLine.classQueues[i]);
+	occupied = aLine.occupied;
+	elementCount = aLine.elementCount;
+
+	aLine.occupied = 0;
+	aLine.elementCount = 0;
+}
+
+
+// Move assignment operator; "aLine" is left with this line's old elements
+template <class ElementType, int CLASS_COUNT>
+MultiClassLine<ElementType, CLASS_COUNT>& MultiClassLine<ElementType, CLASS_COUNT>::operator=(
+	MultiClassLine<ElementType, CLASS_COUNT>&& aLine) {
+
+	if (this != &aLine) {
+		for (int i = 0; i < CLASS_COUNT; i++)
+			classQueues[i] = std::move(aLine.classQueues[i]);
+		swap(occupied, aLine.occupied);
+		swap(elementCount, aLine.elementCount);
+	}
+
+	return *this;
+}
+
+
+// Description: Returns the number of elements in the line, in every class.
+// Time Efficiency: O(1)
+template <class ElementType, int CLASS_COUNT>
+int MultiClassLine<ElementType, CLASS_COUNT>::getElementCount() const {
+	return elementCount;
+}
+
+
+// Description: Returns the number of elements of class "customerClass".
+// Precondition: customerClass is between 0 and CLASS_COUNT - 1.
+// Time Efficiency: O(1)
+template <class ElementType, int CLASS_COUNT>
+int MultiClassLine<ElementType, CLASS_COUNT>::getElementCount(int customerClass) const {
+	return classQueues[customerClass].getElementCount();
+}
+
+
+// Description: Returns "true" is this line is empty, otherwise "false".
+// Time Efficiency: O(1)
+template <class ElementType, int CLASS_COUNT>
+bool MultiClassLine<ElementType, CLASS_COUNT>::isEmpty() const {
+	return occupied == 0;
+}
+
+
+// Description: Adds newElement to the back of its class and returns
+//				its handle.
+// Precondition: customerClass is between 0 and CLASS_COUNT - 1.
+// Time Efficiency: O(1) amortized
+template <class ElementType, int CLASS_COUNT>
+int MultiClassLine<ElementType, CLASS_COUNT>::enqueue(const ElementType& newElement, int customerClass) {
+
+	int position = classQueues[customerClass].enqueue(newElement);
+
+	occupied |= 1u << customerClass;
+	elementCount++;
+
+	// The class is kept in the handle, so remove() knows which queue to look in
+	return position * CLASS_COUNT + customerClass;
+}
+
+
+// Description: Removes the front element of the highest-priority class
+//				with elements, and returns "true" if successful,
+//				otherwise "false".
+// Precondition: This line is not empty.
+// Time Efficiency: O(1)
+template <class ElementType, int CLASS_COUNT>
+bool MultiClassLine<ElementType, CLASS_COUNT>::dequeue() {
+
+	// Enforce precondition that line is not empty
+	if (isEmpty())
+		return false;
+
+	int customerClass = firstOccupiedClass();
+
+	classQueues[customerClass].dequeue();
+	if (classQueues[customerClass].isEmpty())
+		occupied &= ~(1u << customerClass);
+	elementCount--;
+
+	return true;
+}
+
+
+// Description: Returns (a copy of) the front element of the
+//				highest-priority class with elements.
+// Precondition: This line is not empty.
+// Postcondition: This line is unchanged.
+// Exceptions: Throws EmptyDataCollectionException if this line is empty.
+// Time Efficiency: O(1)
+template <class ElementType, int CLASS_COUNT>
+ElementType MultiClassLine<ElementType, CLASS_COUNT>::peek() const throw(EmptyDataCollectionException) {
+
+	// Enforce precondition that line is not empty
+	if (isEmpty())
+		throw EmptyDataCollectionException("peek() called with empty line.");
+
+	return classQueues[firstOccupiedClass()].peek();
+}
+
+
+// Description: Returns the element with the given handle, which may
+//				be changed in place.
+// Precondition: The handle belongs to an element in this line.
+// Time Efficiency: O(1)
+template <class ElementType, int CLASS_COUNT>
+ElementType& MultiClassLine<ElementType, CLASS_COUNT>::get(int handle) {
+	return classQueues[handle % CLASS_COUNT].get(handle / CLASS_COUNT);
+}
+
+
+// Description: Removes the element with the given handle, wherever it
+//				is in the line; the others keep their order.
+//              It returns "true" if successful, or "false" if the
+//				handle does not belong to an element in the line.
+// Postcondition: The handle may be given to a later element.
+// Time Efficiency: O(1)
+template <class ElementType, int CLASS_COUNT>
+bool MultiClassLine<ElementType, CLASS_COUNT>::remove(int handle) {
+
+	if (handle < 0)
+		return false;
+
+	int customerClass = handle % CLASS_COUNT;
+
+	if (!classQueues[customerClass].remove(handle / CLASS_COUNT))
+		return false;
+
+	if (classQueues[customerClass].isEmpty())
+		occupied &= ~(1u << customerClass);
+	elementCount--;
+
+	return true;
+}
+
+
+// Description: Returns the highest-priority class with customers waiting.
+// Precondition: This line is not empty.
+// Time Efficiency: O(1)
+template <class ElementType, int CLASS_COUNT>
+int MultiClassLine<ElementType, CLASS_COUNT>::firstOccupiedClass() const {
+	return __builtin_ctz(occupied);
+}
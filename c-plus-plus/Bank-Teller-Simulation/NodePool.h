@@ -0,0 +1,203 @@
+/*
+* NodePool.h
+*
+* Class Description: A pool allocator for the nodes of a linked container.
+*					 Nodes are carved out of slabs, each twice the size of
+*					 the one before, and released nodes go onto a free list
+*					 to be reused by the next create(). A container that owns
+*					 a pool therefore calls the system allocator only when a
+*					 new slab is needed, not once per node.
+*					 Slabs are returned to the system when the pool is
+*					 destroyed, so a pool must outlive every node it creates.
+*					 Pools are not copied, but can be moved or swapped: the
+*					 slabs, and the nodes in them, change owner without
+*					 being copied or reallocated.
+* Class Invariant: Every slot of every slab is either a live node or on
+*				   the free list.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <new>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class NodeType>
+class NodePool {
+
+	private:
+		// Storage for one node; while free, it holds the free list link instead
+		union Slot {
+			Slot* next;
+			alignas(NodeType) unsigned char storage[sizeof(NodeType)];
+		};
+
+		static const int FIRST_SLAB_SIZE = 16;	// Slots in the first slab
+		static const int MAX_SLAB_SIZE = 65536;	// Slabs stop doubling at this size
+
+		Slot* freeList;				// Free slots, linked through Slot::next
+		vector<Slot*> slabs;		// Every slab allocated, for release
+		int nextSlabSize;			// Slots in the next slab to allocate
+		long long slabAllocations;	// Number of times the system allocator was called
+
+		// Pools own their slabs; they are not copied
+		NodePool(const NodePool<NodeType>& aPool);
+		NodePool<NodeType>& operator=(const NodePool<NodeType>& aPool);
+
+		// Description: Allocates a new slab and puts its slots on the free list.
+		// Time Efficiency: O(slab size)
+		void growSlabs();
+
+	public:
+		// Default constructor
+		NodePool();
+
+		// Move constructor; "aPool" is left empty
+		NodePool(NodePool<NodeType>&& aPool);
+
+		// Move assignment operator; this pool's slabs go to "aPool"
+		// Precondition: Every node created by this pool has been destroyed,
+		//				 or will be by "aPool"'s owner.
+		NodePool<NodeType>& operator=(NodePool<NodeType>&& aPool);
+
+		// Destructor
+		// Precondition: Every node created by this pool has been destroyed.
+		~NodePool();
+
+		// Description: Constructs a node from "arguments" in a free slot and
+		//				returns a pointer to it.
+		// Time Efficiency: O(1) amortized
+		template <class... Arguments>
+		NodeType* create(Arguments&&... arguments);
+
+		// Description: Destroys a node created by this pool and frees its slot.
+		// Time Efficiency: O(1)
+		void destroy(NodeType* node);
+
+		// Description: Returns how many times this pool has called the system
+		//				allocator (once per slab).
+		// Time Efficiency: O(1)
+		long long getSlabAllocationCount() const;
+
+		// Description: Exchanges the slabs and free lists of this pool and
+		//				"aPool", so each owns the other's nodes.
+		// Time Efficiency: O(1)
+		void swap(NodePool<NodeType>& aPool);
+
+}; // end NodePool
+
+
+// Default constructor
+template <class NodeType>
+NodePool<NodeType>::NodePool() {
+	freeList = NULL;
+	nextSlabSize = FIRST_SLAB_SIZE;
+	slabAllocations = 0;
+}
+
+
+// Move constructor; "aPool" is left empty
+template <class NodeType>
+NodePool<NodeType>::NodePool(NodePool<NodeType>&& aPool) {
+	freeList = NULL;
+	nextSlabSize = FIRST_SLAB_SIZE;
+	slabAllocations = 0;
+	swap(aPool);
+}
+
+
+// Move assignment operator; this pool's slabs go to "aPool"
+// Precondition: Every node created by this pool has been destroyed,
+//				 or will be by "aPool"'s owner.
+template <class NodeType>
+NodePool<NodeType>& NodePool<NodeType>::operator=(NodePool<NodeType>&& aPool) {
+	swap(aPool);
+	return *this;
+}
+
+
+// Destructor
+template <class NodeType>
+NodePool<NodeType>::~NodePool() {
+	for (size_t i = 0; i < slabs.size(); i++)
+		delete [] slabs[i];
+}
+
+
+// Description: Constructs a node from "arguments" in a free slot and
+//				returns a pointer to it.
+// Time Efficiency: O(1) amortized
+template <class NodeType>
+template <class... Arguments>
+NodeType* NodePool<NodeType>::create(Arguments&&... arguments) {
+
+	if (!freeList)
+		growSlabs();
+
+	// Take the first free slot and construct the node in place
+	Slot* slot = freeList;
+	freeList = slot->next;
+
+	return new (slot->storage) NodeType(std::forward<Arguments>(arguments)...);
+}
+
+
+// Description: Destroys a node created by this pool and frees its slot.
+// Time Efficiency: O(1)
+template <class NodeType>
+void NodePool<NodeType>::destroy(NodeType* node) {
+
+	if (!node)
+		return;
+
+	node->~NodeType();
+
+	// The node is the first member of its slot; push the slot on the free list
+	Slot* slot = reinterpret_cast<Slot*>(node);
+	slot->next = freeList;
+	freeList = slot;
+}
+
+
+// Description: Returns how many times this pool has called the system
+//				allocator (once per slab).
+// Time Efficiency: O(1)
+template <class NodeType>
+long long NodePool<NodeType>::getSlabAllocationCount() const {
+	return slabAllocations;
+}
+
+
+// Description: Exchanges the slabs and free lists of this pool and
+//				"aPool", so each owns the other's nodes.
+// Time Efficiency: O(1)
+template <class NodeType>
+void NodePool<NodeType>::swap(NodePool<NodeType>& aPool) {
+	std::swap(freeList, aPool.freeList);
+	slabs.swap(aPool.slabs);
+	std::swap(nextSlabSize, aPool.nextSlabSize);
+	std::swap(slabAllocations, aPool.slabAllocations);
+}
+
+
+// Description: Allocates a new slab and puts its slots on the free list.
+// Time Efficiency: O(slab size)
+template <class NodeType>
+void NodePool<NodeType>::growSlabs() {
+
+	Slot* slab = new Slot[nextSlabSize];
+	slabs.push_back(slab);
+	slabAllocations++;
+
+	// Link the slots in address order, so nodes created in sequence are adjacent
+	for (int i = nextSlabSize - 1; i >= 0; i--) {
+		slab[i].next = freeList;
+		freeList = &slab[i];
+	}
+
+	if (nextSlabSize < MAX_SLAB_SIZE)
+		nextSlabSize *= 2;
+}
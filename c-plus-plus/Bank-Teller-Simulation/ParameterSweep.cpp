@@ -0,0 +1,100 @@
+/*
+* ParameterSweep.cpp
+*
+* Class Description: Replays one arrival trace under many configurations
+*					 at once, every run reading the same shared array.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <climits>
+#include <vector>
+#include "ParameterSweep.h"
+#include "HeapPriorityQueue.h"
+#include "WorkStealingPool.h"
+
+using namespace std;
+
+
+// Reads the arrivals of a shared trace in order, with their transaction
+// lengths scaled, as BankSimulation::runSorted() expects
+class ScaledArrivals {
+
+	private:
+		const vector<Event>& trace;	// Arrivals shared by every run
+		size_t position;			// Index of the next arrival next() returns
+		double scale;				// Factor transaction lengths are multiplied by
+
+	public:
+		// Constructor
+		ScaledArrivals(const vector<Event>& arrivals, double serviceScale)
+			: trace(arrivals), position(0), scale(serviceScale) {}
+
+		// Description: Reads the next arrival, with its transaction length
+		//				scaled and rounded, and returns "false" at the end.
+		//				As with ArrivalGenerator, a scaled length is at
+		//				least 1, and it is capped at INT_MAX.
+		bool next(Event& arrival) {
+			if (position == trace.size())
+				return false;
+
+			arrival = trace[position++];
+			if (scale != 1.0 && arrival.getLength() > 0) {
+				double length = arrival.getLength() * scale + 0.5;
+
+				if (length < 1.0)
+					length = 1.0;
+				else if (length > INT_MAX)
+					length = INT_MAX;
+				arrival = Event(ARRIVAL, arrival.getTime(), (int)length);
+			}
+			return true;
+		}
+
+}; // end ScaledArrivals
+
+
+// Description: Simulates the arrivals in "trace" once for each of
+//				"configurations", with the given line policy and customer
+//				behavior, on "threads" threads (or one per core if threads
+//				is 0), and returns the results in the order of the
+//				configurations.
+// Precondition: trace is sorted by arrival time, ties in input order.
+//				 Every configuration has 1 to 65536 tellers and a positive
+//				 service scale. behavior is valid for
+//				 BankSimulation::setBehavior().
+// Time Efficiency: O(configurations * n log k / threads) for n arrivals
+vector<SweepResult> runSweep(const vector<Event>& trace, const vector<SweepConfiguration>& configurations,
+	LinePolicy linePolicy, const CustomerBehavior& behavior, int threads) {
+
+	vector<SweepResult> results(configurations.size());
+	WorkStealingPool pool(threads);
+
+	// Each run writes only its own result, so the runs need no locking
+	pool.run(configurations.size(), [&](int worker, int run) {
+		const SweepConfiguration& configuration = configurations[run];
+		BankSimulation< HeapPriorityQueue<Event> > simulation(configuration.tellers, linePolicy);
+		ScaledArrivals arrivals(trace, configuration.serviceScale);
+
+		simulation.setBehavior(behavior);
+		simulation.runSorted(arrivals);
+
+		const SimulationStatistics& statistics = simulation.getStatistics();
+		SweepResult& result = results[run];
+
+		result.configuration = configuration;
+		result.customers = statistics.getCustomersServed();
+		result.customersReneged = statistics.getCustomersReneged();
+		result.customersBalked = statistics.getCustomersBalked();
+		result.averageWait = (statistics.getCustomersServed() > 0)
+			? (double)statistics.getTotalWaitTime() / statistics.getCustomersServed() : 0.0;
+		result.waitP50 = statistics.getWaitAtPercentile(50.0);
+		result.waitP90 = statistics.getWaitAtPercentile(90.0);
+		result.waitP99 = statistics.getWaitAtPercentile(99.0);
+		result.maxWait = statistics.getMaxWait();
+		result.averageLineLength = statistics.getAverageLineLength();
+		result.utilization = statistics.getUtilization();
+	});
+
+	return results;
+}
@@ -0,0 +1,61 @@
+/*
+* ParameterSweep.h
+*
+* Class Description: Replays one arrival trace under many configurations
+*					 (teller counts and scalings of the transaction
+*					 lengths) at once, for staffing decisions.
+*					 The trace is read once into an array that every run
+*					 shares read-only; each run streams through it,
+*					 scaling transaction lengths as it reads them, so no
+*					 run copies the input, and each holds only its own
+*					 departures. Runs are spread over a WorkStealingPool.
+*					 Every run has the same customer behavior (patience,
+*					 balking and classes), seeded alike, so configurations
+*					 are compared on the same customers. Each run's results
+*					 depend only on its configuration, not on the number of
+*					 threads.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <vector>
+#include "Event.h"
+#include "BankSimulation.h"
+
+using namespace std;
+
+// One configuration of a sweep
+struct SweepConfiguration {
+	int tellers;			// Number of tellers
+	double serviceScale;	// Factor every transaction length is multiplied by
+};
+
+// Results of one configuration of a sweep
+struct SweepResult {
+	SweepConfiguration configuration;	// Configuration simulated
+	long long customers;		// Customers served
+	long long customersReneged;	// Customers who gave up waiting
+	long long customersBalked;	// Customers who would not join a line
+	double averageWait;			// Average time spent waiting in line
+	int waitP50;				// Median waiting time
+	int waitP90;				// 90th percentile waiting time
+	int waitP99;				// 99th percentile waiting time
+	int maxWait;				// Longest waiting time
+	double averageLineLength;	// Time-weighted average number of customers in line
+	double utilization;			// Fraction of teller time spent serving
+};
+
+
+// Description: Simulates the arrivals in "trace" once for each of
+//				"configurations", with the given line policy and customer
+//				behavior, on "threads" threads (or one per core if threads
+//				is 0), and returns the results in the order of the
+//				configurations.
+// Precondition: trace is sorted by arrival time, ties in input order.
+//				 Every configuration has 1 to 65536 tellers and a positive
+//				 service scale. behavior is valid for
+//				 BankSimulation::setBehavior().
+// Time Efficiency: O(configurations * n log k / threads) for n arrivals
+vector<SweepResult> runSweep(const vector<Event>& trace, const vector<SweepConfiguration>& configurations,
+	LinePolicy linePolicy, const CustomerBehavior& behavior, int threads);
@@ -6,12 +6,22 @@
 * Class Invariant: Highest priority is defined as lowest element value, and
 *				   elements are therefore sorted in ascending order from front
 *				   to back. Elements are always sorted.
+*				   Nodes come from the queue's own NodePool, so enqueue and
+*				   dequeue reuse freed nodes instead of calling new/delete.
+*				   Moving a queue hands over its nodes and their pool
+*				   without copying or allocating anything.
+*				   enqueueAll() links a whole range at once: in O(n) if
+*				   the range is already sorted, otherwise after a stable
+*				   sort, instead of walking the list for every element.
 * Created on: June 20, 2017
 * Author: Andrew Adams
 */
 
 #pragma once
+#include <algorithm>
+#include <vector>
 #include "Node.h"
+#include "NodePool.h"
 #include "EmptyDataCollectionException.h"
 
 template <class ElementType>
@@ -20,6 +30,7 @@ class PriorityQueue {
 	private: 
 		Node<ElementType> *head;	// Pointer to the front of the queue
 		int elementCount;			// Total number of elements in queue
+		NodePool< Node<ElementType> > nodePool;	// Allocates this queue's nodes
 
 	public:
 		// Default constructor
@@ -28,6 +39,20 @@ class PriorityQueue {
 		// Copy constructor
 		PriorityQueue(const PriorityQueue<ElementType>& pQ);
 
+		// Range constructor; enqueues every element from "first" to "last"
+		// Time Efficiency: O(n) if the range is sorted, otherwise O(n log n)
+		template <class InputIterator>
+		PriorityQueue(InputIterator first, InputIterator last);
+
+		// Move constructor; "pQ" is left empty
+		PriorityQueue(PriorityQueue<ElementType>&& pQ);
+
+		// Assignment operator
+		PriorityQueue<ElementType>& operator=(const PriorityQueue<ElementType>& pQ);
+
+		// Move assignment operator; "pQ" is left with this queue's old elements
+		PriorityQueue<ElementType>& operator=(PriorityQueue<ElementType>&& pQ);
+
 		// Destructor
 		~PriorityQueue();
 
@@ -50,6 +75,17 @@ class PriorityQueue {
 		// Postcondition: Once newElement is inserted, this Priority Queue remains sorted.    
 		// Time Efficiency: O(n)        
 		bool enqueue(const ElementType& newElement);
+
+		// Description: Inserts every element from "first" to "last" in sort
+		//				order, after any equal elements already queued, and
+		//				keeping equal elements of the range in range order,
+		//				just as enqueue() would one at a time.
+		//              It returns "true" if successful, otherwise "false".
+		// Postcondition: This Priority Queue remains sorted.
+		// Time Efficiency: O(n + m) if the m new elements are sorted,
+		//					otherwise O(n + m log m)
+		template <class InputIterator>
+		bool enqueueAll(InputIterator first, InputIterator last);
       
 		// Description: Removes the element with the "highest" priority.
 		//              It returns "true" if successful, otherwise "false".
@@ -70,6 +106,15 @@ class PriorityQueue {
 		// Exceptions: Throws EmptyDataCollectionException if this Priority Queue is empty.
 		// Time Efficiency: O(n) 
 		void printPriorityQueue();
+
+		// Description: Calls visit(element, rank) for every element, front
+		//				to back. Equal elements leave the queue in the order
+		//				of their ranks, so enqueuing every element in rank
+		//				order rebuilds this queue.
+		// Postcondition: This Priority Queue is unchanged.
+		// Time Efficiency: O(n)
+		template <class Visit>
+		void forEachEntry(Visit visit) const;
    
 		/******* Public Interface - END - *******/
 
@@ -94,6 +139,7 @@ PriorityQueue<ElementType>::PriorityQueue(const PriorityQueue<ElementType>& pQ)
 	
 	// Copy element count
 	elementCount = pQ.elementCount;
+	head = NULL;
 	
 	Node<ElementType>* newCopy;
 	Node<ElementType>* prevCopy;
@@ -102,13 +148,13 @@ PriorityQueue<ElementType>::PriorityQueue(const PriorityQueue<ElementType>& pQ)
 	// new queue that is a copy
 	if (pQ.head) {	
 		prevCopy = pQ.head;
-		newCopy = new Node<ElementType>(prevCopy->getElement(), prevCopy->getNextNode());
+		newCopy = nodePool.create(prevCopy->getElement(), prevCopy->getNextNode());
 		head = newCopy;
 
 		while (newCopy->getNextNode() != NULL) {
 
 			prevCopy = newCopy;
-			newCopy = new Node<ElementType>(prevCopy->getNextNode()->getElement(),
+			newCopy = nodePool.create(prevCopy->getNextNode()->getElement(),
 				prevCopy->getNextNode()->getNextNode());
 			prevCopy->setNextNode(newCopy);
 		}
@@ -121,6 +167,58 @@ PriorityQueue<ElementType>::PriorityQueue(const PriorityQueue<ElementType>& pQ)
 }
 
 
+// Range constructor; enqueues every element from "first" to "last"
+// Time Efficiency: O(n) if the range is sorted, otherwise O(n log n)
+template <class ElementType>
+template <class InputIterator>
+PriorityQueue<ElementType>::PriorityQueue(InputIterator first, InputIterator last) {
+	head = NULL;
+	elementCount = 0;
+	enqueueAll(first, last);
+}
+
+
+// Move constructor; "pQ" is left empty
+template <class ElementType>
+PriorityQueue<ElementType>::PriorityQueue(PriorityQueue<ElementType>&& pQ)
+	: nodePool(std::move(pQ.nodePool)) {
+
+	// The nodes stay where they are; only the pointers change owner
+	head = pQ.head;
+	elementCount = pQ.elementCount;
+	pQ.head = NULL;
+	pQ.elementCount = 0;
+}
+
+
+// Assignment operator
+template <class ElementType>
+PriorityQueue<ElementType>& PriorityQueue<ElementType>::operator=(const PriorityQueue<ElementType>& pQ) {
+
+	if (this != &pQ) {
+		PriorityQueue<ElementType> copy(pQ);
+		*this = std::move(copy);
+	}
+
+	return *this;
+}
+
+
+// Move assignment operator; "pQ" is left with this queue's old elements
+template <class ElementType>
+PriorityQueue<ElementType>& PriorityQueue<ElementType>::operator=(PriorityQueue<ElementType>&& pQ) {
+
+	// Each queue takes the other's nodes together with the pool they live in
+	if (this != &pQ) {
+		std::swap(head, pQ.head);
+		std::swap(elementCount, pQ.elementCount);
+		nodePool.swap(pQ.nodePool);
+	}
+
+	return *this;
+}
+
+
 // Description: Returns the number of elements in the Priority Queue.
 // (This method eases testing.)
 // Time Efficiency: O(1) 
@@ -158,7 +256,7 @@ bool PriorityQueue<ElementType>::enqueue(const ElementType& newElement) {
 	Node<ElementType>* elementToAdd;	// Pointer to a Node which will hold element to insert
 
 	// Create new node containing the element passed in
-	elementToAdd = new Node<ElementType>(newElement);
+	elementToAdd = nodePool.create(newElement);
 
 	Node<ElementType>* currentNode;		// Pointer to the current Node being compared
 										// to the Node to be inserted
@@ -224,6 +322,87 @@ bool PriorityQueue<ElementType>::enqueue(const ElementType& newElement) {
 }
 
 
+// Description: Inserts every element from "first" to "last" in sort
+//				order, after any equal elements already queued, and
+//				keeping equal elements of the range in range order,
+//				just as enqueue() would one at a time.
+//              It returns "true" if successful, otherwise "false".
+// Postcondition: This Priority Queue remains sorted.
+// Time Efficiency: O(n + m) if the m new elements are sorted,
+//					otherwise O(n + m log m)
+template <class ElementType>
+template <class InputIterator>
+bool PriorityQueue<ElementType>::enqueueAll(InputIterator first, InputIterator last) {
+
+	Node<ElementType>* newHead = NULL;	// Front of the chain of new nodes
+	Node<ElementType>* newTail = NULL;	// Back of the chain of new nodes
+	bool sorted = true;					// Whether the range is in sort order
+	int added = 0;						// Number of new nodes
+
+	// Link the new elements into a chain in range order, noting whether
+	// each is in order after the one before
+	for (; first != last; ++first) {
+		Node<ElementType>* node = nodePool.create(*first);
+
+		if (newTail) {
+			if (newTail->getElement() > node->getElement())
+				sorted = false;
+			newTail->setNextNode(node);
+		}
+		else
+			newHead = node;
+
+		newTail = node;
+		added++;
+	}
+
+	// Otherwise sort the chain's nodes; a stable sort keeps equal elements
+	// in the order they were given
+	if (!sorted) {
+		vector< Node<ElementType>* > nodes;
+		nodes.reserve(added);
+		for (Node<ElementType>* node = newHead; node; node = node->getNextNode())
+			nodes.push_back(node);
+
+		stable_sort(nodes.begin(), nodes.end(),
+			[](Node<ElementType>* lhs, Node<ElementType>* rhs) { return rhs->getElement() > lhs->getElement(); });
+
+		for (int i = 0; i + 1 < added; i++)
+			nodes[i]->setNextNode(nodes[i + 1]);
+		nodes[added - 1]->setNextNode(NULL);
+		newHead = nodes[0];
+	}
+
+	// Merge the sorted chain into the queue; on ties, queued elements
+	// stay ahead of new ones
+	Node<ElementType>* merged = NULL;	// Back of the merged list so far
+	Node<ElementType>* queued = head;	// Next queued node to merge
+
+	head = NULL;
+	while (queued || newHead) {
+		Node<ElementType>* next;
+
+		if (queued && (!newHead || !(queued->getElement() > newHead->getElement()))) {
+			next = queued;
+			queued = queued->getNextNode();
+		}
+		else {
+			next = newHead;
+			newHead = newHead->getNextNode();
+		}
+
+		if (merged)
+			merged->setNextNode(next);
+		else
+			head = next;
+		merged = next;
+	}
+
+	elementCount += added;
+	return true;
+}
+
+
 // Description: Removes the element with the "highest" priority.
 //              It returns "true" if successful, otherwise "false".
 // Precondition: This Priority Queue is not empty.
@@ -247,7 +426,7 @@ bool PriorityQueue<ElementType>::dequeue() {
 		isDequeued = false;
 	}
 
-	delete toDequeue;
+	nodePool.destroy(toDequeue);
 
 	return isDequeued;
 }
@@ -299,6 +478,23 @@ void PriorityQueue<ElementType>::printPriorityQueue() {
 }
 
 
+// Description: Calls visit(element, rank) for every element, front to
+//				back. Equal elements leave the queue in the order of their
+//				ranks, so enqueuing every element in rank order rebuilds
+//				this queue.
+// Postcondition: This Priority Queue is unchanged.
+// Time Efficiency: O(n)
+template <class ElementType>
+template <class Visit>
+void PriorityQueue<ElementType>::forEachEntry(Visit visit) const {
+
+	unsigned long long rank = 0;
+
+	for (Node<ElementType>* currentNode = head; currentNode; currentNode = currentNode->getNextNode())
+		visit(currentNode->getElement(), rank++);
+}
+
+
 // Destructor
 template <class ElementType>
 PriorityQueue<ElementType>::~PriorityQueue() {
@@ -313,7 +509,7 @@ PriorityQueue<ElementType>::~PriorityQueue() {
 	while (toDelete) {
 		prev = toDelete;
 		toDelete = toDelete->getNextNode();
-		delete prev;
+		nodePool.destroy(prev);
 	}
 
 	head = NULL;
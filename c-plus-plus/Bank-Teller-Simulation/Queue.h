@@ -1,8 +1,17 @@
 /*
 * Queue.h
 *
-* Class Description: A standard queue of fixed capacity using a
-*					 circular-array implementation
+* Class Description: A standard queue using a circular-array implementation.
+*					 The array's capacity is always a power of two, so
+*					 positions wrap around with a bit mask instead of %.
+*					 A capacity policy decides whether the array grows when
+*					 full (GrowableCapacity, the default) or the queue has a
+*					 fixed capacity (FixedCapacity<N>). Growing doubles the
+*					 array and moves the elements across, so enqueue is
+*					 amortized O(1); GrowableCapacity<true> also halves the
+*					 array when it falls to a quarter full.
+*					 Moving a queue hands over its array; the moved-from
+*					 queue is empty, with no array until its next enqueue.
 * Class Invariant: FIFO/LILO. Elements added to back of queue
 *				   and removed from front
 * Created on: June 20, 2017
@@ -11,27 +20,72 @@
 
 #pragma once
 #include <iostream>
+#include <utility>
 #include "Event.h"
 #include "EmptyDataCollectionException.h"
 
 using namespace std;
 
-template <class ElementType>
+
+// Capacity policy: the queue grows without limit, and optionally shrinks
+template <bool SHRINKS = false>
+struct GrowableCapacity {
+	static const int INITIAL_CAPACITY = 16;		// Array capacity of a new queue
+	static const int MAXIMUM_ELEMENTS = 0x40000000;
+	static const bool GROWS = true;
+	static const bool SHRINK = SHRINKS;
+};
+
+// Capacity policy: the queue holds at most CAPACITY elements and enqueue
+// fails when it is full
+template <int CAPACITY>
+struct FixedCapacity {
+	static const int INITIAL_CAPACITY = CAPACITY;
+	static const int MAXIMUM_ELEMENTS = CAPACITY;
+	static const bool GROWS = false;
+	static const bool SHRINK = false;
+};
+
+
+template <class ElementType, class CapacityPolicy = GrowableCapacity<> >
 class Queue {
 
 	private:
-		static const int CAPACITY = 100;		// Fixed capacity of queue
-		ElementType elementQueue[CAPACITY];		// Array of queue capacity
-		int front;								// Index of front of queue
-		int back;								// Index of back of queue
-		int elementCount;						// Element count
+		ElementType* elementQueue;		// Circular array of "capacity" elements
+		int capacity;					// Array capacity, a power of two
+		int front;						// Index of front of queue
+		int elementCount;				// Element count
+
+		// Description: Returns the smallest power of two not less than count.
+		// Time Efficiency: O(log count)
+		static int roundUpToPowerOfTwo(int count);
+
+		// Description: Moves the elements into a new array of newCapacity.
+		// Precondition: newCapacity is a power of two not less than elementCount.
+		// Time Efficiency: O(n)
+		void resize(int newCapacity);
 
 	public:
 		// Constructor
 		Queue();
 
+		// Copy constructor
+		Queue(const Queue<ElementType, CapacityPolicy>& aQueue);
+
+		// Move constructor; "aQueue" is left empty
+		Queue(Queue<ElementType, CapacityPolicy>&& aQueue);
+
+		// Assignment operator
+		Queue<ElementType, CapacityPolicy>& operator=(const Queue<ElementType, CapacityPolicy>& aQueue);
+
+		// Move assignment operator; "aQueue" is left with this queue's old elements
+		Queue<ElementType, CapacityPolicy>& operator=(Queue<ElementType, CapacityPolicy>&& aQueue);
+
+		// Destructor
+		~Queue();
+
 		/******* Public Interface - START - *******/
-	        
+
 		// Description: Returns the number of elements in the Queue.
 		// (This method eases testing.)
 		// Time Efficiency: O(1)
@@ -40,35 +94,36 @@ class Queue {
 		// Description: Returns "true" is this Queue is empty, otherwise "false".
 		// Time Efficiency: O(1)
 		bool isEmpty() const;
-	   
-		// Description: Adds newElement to the "back" of this Queue 
-		//              (not necessarily the "back" of its data structure) and 
+
+		// Description: Adds newElement to the "back" of this Queue
+		//              (not necessarily the "back" of its data structure) and
 		//              returns "true" if successful, otherwise "false".
-		// Time Efficiency: O(1)
+		//				Fails only if the capacity policy is fixed and the queue is full.
+		// Time Efficiency: O(1) amortized
 		bool enqueue(const ElementType& newElement);
 
-		// Description: Removes the element at the "front" of this Queue 
-		//              (not necessarily the "front" of its data structure) and  
+		// Description: Removes the element at the "front" of this Queue
+		//              (not necessarily the "front" of its data structure) and
 		//              returns "true" if successful, otherwise "false".
 		// Precondition: This Queue is not empty.
-		// Time Efficiency: O(1)
+		// Time Efficiency: O(1) amortized
 		bool dequeue();
-	   
+
 		// Description: Returns (a copy of) the element located at the "front" of this Queue.
 		// Precondition: This Queue is not empty.
 		// Postcondition: This Queue is unchanged.
 		// Exceptions: Throws EmptyDataCollectionException if this Queue is empty.
 		// Time Efficiency: O(1)
-		ElementType peek() const throw(EmptyDataCollectionException);  
+		ElementType peek() const throw(EmptyDataCollectionException);
 
 		/******* Public Interface - END - *******/
 
-		// Description: 
+		// Description: Prints contents of queue.
 		// Precondition: This Queue is not empty.
 		// Postcondition: This Queue is unchanged.
 		// Time Efficiency: O(n)
 		void printQueue();
-	      
+
 }; // end Queue
 
 
@@ -76,26 +131,96 @@ class Queue {
 using namespace std;
 
 // Constructor
-template <class ElementType>
-Queue<ElementType>::Queue() {
+template <class ElementType, class CapacityPolicy>
+Queue<ElementType, CapacityPolicy>::Queue() {
+	capacity = roundUpToPowerOfTwo(CapacityPolicy::INITIAL_CAPACITY);
+	elementQueue = new ElementType[capacity];
 	front = 0;
-	back = CAPACITY - 1;
 	elementCount = 0;
 } // end default constructor
 
 
+// Copy constructor
+template <class ElementType, class CapacityPolicy>
+Queue<ElementType, CapacityPolicy>::Queue(const Queue<ElementType, CapacityPolicy>& aQueue) {
+	capacity = aQueue.capacity;
+	elementQueue = new ElementType[capacity];
+	front = 0;
+	elementCount = aQueue.elementCount;
+
+	// Copy elements front to back, starting at index 0
+	for (int i = 0; i < elementCount; i++)
+		elementQueue[i] = aQueue.elementQueue[(aQueue.front + i) & (capacity - 1)];
+} // end copy constructor
+
+
+// Move constructor; "aQueue" is left empty
+template <class ElementType, class CapacityPolicy>
+Queue<ElementType, CapacityPolicy>::Queue(Queue<ElementType, CapacityPolicy>&& aQueue) {
+	elementQueue = aQueue.elementQueue;
+	capacity = aQueue.capacity;
+	front = aQueue.front;
+	elementCount = aQueue.elementCount;
+
+	aQueue.elementQueue = NULL;
+	aQueue.capacity = 0;
+	aQueue.front = 0;
+	aQueue.elementCount = 0;
+} // end move constructor
+
+
+// Assignment operator
+template <class ElementType, class CapacityPolicy>
+Queue<ElementType, CapacityPolicy>& Queue<ElementType, CapacityPolicy>::operator=(
+	const Queue<ElementType, CapacityPolicy>& aQueue) {
+
+	if (this != &aQueue) {
+		Queue<ElementType, CapacityPolicy> copy(aQueue);
+		swap(elementQueue, copy.elementQueue);
+		swap(capacity, copy.capacity);
+		swap(front, copy.front);
+		swap(elementCount, copy.elementCount);
+	}
+
+	return *this;
+}
+
+
+// Move assignment operator; "aQueue" is left with this queue's old elements
+template <class ElementType, class CapacityPolicy>
+Queue<ElementType, CapacityPolicy>& Queue<ElementType, CapacityPolicy>::operator=(
+	Queue<ElementType, CapacityPolicy>&& aQueue) {
+
+	if (this != &aQueue) {
+		swap(elementQueue, aQueue.elementQueue);
+		swap(capacity, aQueue.capacity);
+		swap(front, aQueue.front);
+		swap(elementCount, aQueue.elementCount);
+	}
+
+	return *this;
+}
+
+
+// Destructor
+template <class ElementType, class CapacityPolicy>
+Queue<ElementType, CapacityPolicy>::~Queue() {
+	delete [] elementQueue;
+}
+
+
 // Description: Returns the number of elements in the Queue.
 // (This method eases testing.)
 // Time Efficiency: O(1)
-template <class ElementType>
-int Queue<ElementType>::getElementCount() const {
+template <class ElementType, class CapacityPolicy>
+int Queue<ElementType, CapacityPolicy>::getElementCount() const {
 	return elementCount;
 }
 
 // Description: Returns "true" is this Queue is empty, otherwise "false".
 // Time Efficiency: O(1)
-template <class ElementType>
-bool Queue<ElementType>::isEmpty() const {
+template <class ElementType, class CapacityPolicy>
+bool Queue<ElementType, CapacityPolicy>::isEmpty() const {
 
 	bool empty;
 
@@ -107,54 +232,53 @@ bool Queue<ElementType>::isEmpty() const {
 	return empty;
 }
 
-// Description: Adds newElement to the "back" of this Queue 
-//              (not necessarily the "back" of its data structure) and 
+// Description: Adds newElement to the "back" of this Queue
+//              (not necessarily the "back" of its data structure) and
 //              returns "true" if successful, otherwise "false".
-// Time Efficiency: O(1)
-template <class ElementType>
-bool Queue<ElementType>::enqueue(const ElementType& newElement) {
-
-	bool isEnqueued;	// True once element is enqueued, false if not
-
-	// Create a "circular" array, in which back and front
-	// can loop around as elements are enqueued and dequeued.
-	// If queue is not full, then set "back" to next index in
-	// array (looping around to index 0 if at the end of the
-	// array) and add newElement at the back position
-	if (elementCount != CAPACITY) {
-		back = (back + 1) % CAPACITY;
-		elementQueue[back] = newElement;
-		elementCount++;
-		isEnqueued = true;
-	}
-	else
-		isEnqueued = false;
+//				Fails only if the capacity policy is fixed and the queue is full.
+// Time Efficiency: O(1) amortized
+template <class ElementType, class CapacityPolicy>
+bool Queue<ElementType, CapacityPolicy>::enqueue(const ElementType& newElement) {
+
+	// Enforce the policy's limit on the number of elements
+	if (elementCount == CapacityPolicy::MAXIMUM_ELEMENTS)
+		return false;
+
+	// A full array doubles before the new element is added; a moved-from
+	// queue has no array and starts again at the initial capacity
+	if (elementCount == capacity)
+		resize(capacity > 0 ? capacity * 2 : roundUpToPowerOfTwo(CapacityPolicy::INITIAL_CAPACITY));
+
+	// The back of the "circular" array wraps around to index 0 by masking
+	elementQueue[(front + elementCount) & (capacity - 1)] = newElement;
+	elementCount++;
 
-	return isEnqueued;
+	return true;
 }
 
-// Description: Removes the element at the "front" of this Queue 
-//              (not necessarily the "front" of its data structure) and  
+// Description: Removes the element at the "front" of this Queue
+//              (not necessarily the "front" of its data structure) and
 //              returns "true" if successful, otherwise "false".
 // Precondition: This Queue is not empty.
-// Time Efficiency: O(1)
-template <class ElementType>
-bool Queue<ElementType>::dequeue() {
-
-	bool dequeued;	// True if element dequeued, false if not
-
-	// If array is not empty, dequeue element at "front" by
-	// moving front one index position to the right and
-	// decrementing elementCount
-	if (!isEmpty()) {
-		front = (front + 1) % CAPACITY;
-		elementCount--;
-		dequeued = true;
-	}
-	else
-		dequeued = false;
+// Time Efficiency: O(1) amortized
+template <class ElementType, class CapacityPolicy>
+bool Queue<ElementType, CapacityPolicy>::dequeue() {
+
+	// Enforce precondition that queue is not empty
+	if (isEmpty())
+		return false;
+
+	// Release the front element's resources and move front one position right
+	elementQueue[front] = ElementType();
+	front = (front + 1) & (capacity - 1);
+	elementCount--;
+
+	// A shrinking queue halves its array once it is a quarter full
+	if (CapacityPolicy::SHRINK && capacity > CapacityPolicy::INITIAL_CAPACITY
+		&& elementCount <= capacity / 4)
+		resize(capacity / 2);
 
-	return dequeued;
+	return true;
 }
 
 // Description: Returns (a copy of) the element located at the "front" of this Queue.
@@ -162,52 +286,62 @@ bool Queue<ElementType>::dequeue() {
 // Postcondition: This Queue is unchanged.
 // Exceptions: Throws EmptyDataCollectionException if this Queue is empty.
 // Time Efficiency: O(1)
-template <class ElementType>
-ElementType Queue<ElementType>::peek() const throw(EmptyDataCollectionException) {
-
-	// Get element at front of queue
-	ElementType peeked;
-	peeked = elementQueue[front];
+template <class ElementType, class CapacityPolicy>
+ElementType Queue<ElementType, CapacityPolicy>::peek() const throw(EmptyDataCollectionException) {
 
 	// Enforce precondition that queue is not empty
 	if (isEmpty())
 		throw EmptyDataCollectionException("peek() called with empty queue.");
 
 	// Queue is not empty; return front
-	return peeked;
+	return elementQueue[front];
 }
 
 // Description: Prints contents of queue.
 // Precondition: This Queue is not empty.
 // Postcondition: This Queue is unchanged.
 // Time Efficiency: O(n)
-template <class ElementType>
-void Queue<ElementType>::printQueue() {
-
-	int printIndex = 0;
-
-	// Starting from "front", while the index of
-	// of "front" is less than capacity of the array,
-	// print value at that index; once end of array is
-	// reached, loop back around to front (index 0) of
-	// array and continue printing through array until
-	// all elements printed
-	for (int i = 0; i < elementCount; i++) {
-		if ((front + i) < CAPACITY)
-			cout << elementQueue[front + i];
-		else {
-			cout << elementQueue[printIndex];
-			printIndex++;
-		}
-	}
+template <class ElementType, class CapacityPolicy>
+void Queue<ElementType, CapacityPolicy>::printQueue() {
+
+	// Starting from "front", print each element, wrapping
+	// around to index 0 at the end of the array
+	for (int i = 0; i < elementCount; i++)
+		cout << elementQueue[(front + i) & (capacity - 1)];
 
 	if (elementCount == 0)
 		cout << endl << "Bank line is empty" << endl;
 }
 
-/*
-template <class ElementType>
-Queue<ElementType>::~Queue() {
 
+// Description: Returns the smallest power of two not less than count.
+// Time Efficiency: O(log count)
+template <class ElementType, class CapacityPolicy>
+int Queue<ElementType, CapacityPolicy>::roundUpToPowerOfTwo(int count) {
+
+	int powerOfTwo = 1;
+
+	while (powerOfTwo < count)
+		powerOfTwo *= 2;
+
+	return powerOfTwo;
+}
+
+
+// Description: Moves the elements into a new array of newCapacity.
+// Precondition: newCapacity is a power of two not less than elementCount.
+// Time Efficiency: O(n)
+template <class ElementType, class CapacityPolicy>
+void Queue<ElementType, CapacityPolicy>::resize(int newCapacity) {
+
+	ElementType* newQueue = new ElementType[newCapacity];
+
+	// Move elements front to back into the new array, starting at index 0
+	for (int i = 0; i < elementCount; i++)
+		newQueue[i] = std::move(elementQueue[(front + i) & (capacity - 1)]);
+
+	delete [] elementQueue;
+	elementQueue = newQueue;
+	capacity = newCapacity;
+	front = 0;
 }
-*/
\ No newline at end of file
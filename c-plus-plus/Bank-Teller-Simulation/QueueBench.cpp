@@ -0,0 +1,290 @@
+/*
+* QueueBench.cpp
+*
+* Class Description: Benchmarks the queues used by the simulation: the
+*					 FIFO customer lines (Queue, and IndexedQueue, which can
+*					 remove from the middle) and the event priority
+*					 queues, the sorted linked list (PriorityQueue), the
+*					 4-ary heap (HeapPriorityQueue), the indexed heap
+*					 (IndexedHeapPriorityQueue) and the monotone radix
+*					 heap (RadixHeap), with 10^2 to 10^7 events.
+*					 "sorted", "reverse" and "random" enqueue N arrival events
+*					 with times in increasing, decreasing or random order and
+*					 then dequeue them all; "sorted bulk", "reverse bulk" and
+*					 "random bulk" build the priority queue from the whole
+*					 range at once with enqueueAll(), as main() does, and
+*					 run the linked list at every size. "hold"
+*					 keeps N events queued while repeatedly dequeuing the
+*					 earliest and enqueuing a later one, as the departures
+*					 of a simulation do.
+*					 "copy" and "move" hand a queue of N events to another
+*					 queue, as main() hands its arrivals to the simulation;
+*					 a move that calls operator new fails the benchmark.
+*					 "cancel half" enqueues N events in random order,
+*					 removes every other one by its handle, as customers
+*					 who renege are, then dequeues the rest.
+*					 Output is CSV (see BenchHarness.h); each enqueue and
+*					 each dequeue is one operation.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <utility>
+#include <random>
+#include <vector>
+#include "Event.h"
+#include "Queue.h"
+#include "IndexedQueue.h"
+#include "PriorityQueue.h"
+#include "HeapPriorityQueue.h"
+#include "IndexedHeapPriorityQueue.h"
+#include "RadixHeap.h"
+#include "BenchHarness.h"
+
+using namespace std;
+
+
+// Largest queue the O(n) linked list is benchmarked with, and held at
+const int LIST_LIMIT = 10000;
+const int LIST_HOLD_LIMIT = 1000;
+
+// Dequeue/enqueue pairs timed in the hold model
+const int HOLD_OPERATIONS = 200000;
+
+
+// Description: Returns "count" event times in the order named by "workload":
+//				"sorted", "reverse" or "random"
+vector<int> makeTimes(const string& workload, int count) {
+
+	mt19937 generator(225);
+	uniform_int_distribution<int> time(0, count * 10);
+	vector<int> times(count);
+
+	for (int i = 0; i < count; i++) {
+		if (workload == "sorted")
+			times[i] = i;
+		else if (workload == "reverse")
+			times[i] = count - i;
+		else
+			times[i] = time(generator);
+	}
+
+	return times;
+}
+
+
+// Description: Enqueues "count" arrival events with times in the order named
+//				by "workload", then dequeues them all
+template <class EventQueue>
+BenchResult benchmarkPreload(const string& queueName, const string& workload, int count) {
+
+	vector<int> times = makeTimes(workload, count);
+	EventQueue queue;
+	BenchResult result = { "queue", queueName, workload, count, 2LL * count, 0.0, 0 };
+
+	BenchTimer timer;
+
+	for (int i = 0; i < count; i++)
+		queue.enqueue(Event(ARRIVAL, times[i], 5));
+	while (!queue.isEmpty())
+		queue.dequeue();
+
+	timer.stop(result);
+	return result;
+}
+
+
+// Description: Enqueues "count" arrival events with times in the order named
+//				by "workload" all at once with enqueueAll(), then dequeues
+//				them all
+template <class EventQueue>
+BenchResult benchmarkBulkLoad(const string& queueName, const string& workload, int count) {
+
+	vector<int> times = makeTimes(workload, count);
+	vector<Event> events;
+	EventQueue queue;
+	BenchResult result = { "queue", queueName, workload + " bulk", count, 2LL * count, 0.0, 0 };
+
+	events.reserve(count);
+	for (int i = 0; i < count; i++)
+		events.push_back(Event(ARRIVAL, times[i], 5));
+
+	BenchTimer timer;
+
+	queue.enqueueAll(events.begin(), events.end());
+	while (!queue.isEmpty())
+		queue.dequeue();
+
+	timer.stop(result);
+	return result;
+}
+
+
+// Description: Fills a queue with "count" events, then repeatedly replaces the
+//				earliest with one scheduled after it
+template <class EventQueue>
+BenchResult benchmarkHold(const string& queueName, int count) {
+
+	mt19937 generator(225);
+	uniform_int_distribution<int> increment(1, count);
+	EventQueue queue;
+	BenchResult result = { "queue", queueName, "hold", count, 2LL * HOLD_OPERATIONS, 0.0, 0 };
+
+	for (int i = 0; i < count; i++)
+		queue.enqueue(Event(DEPARTURE, increment(generator), 5));
+
+	BenchTimer timer;
+
+	for (int i = 0; i < HOLD_OPERATIONS; i++) {
+		Event earliest = queue.peek();
+		queue.dequeue();
+		queue.enqueue(Event(DEPARTURE, earliest.getTime() + increment(generator), 5));
+	}
+
+	timer.stop(result);
+	return result;
+}
+
+
+// Description: Fills a queue with "count" events and hands them to another
+//				queue, by copying or by move construction and move assignment.
+//				Exits with an error if a move allocates anything
+template <class EventQueue>
+BenchResult benchmarkHandoff(const string& queueName, bool moving, int count) {
+
+	vector<int> times = makeTimes("random", count);
+	EventQueue queue;
+	EventQueue target;
+	BenchResult result = { "queue", queueName, moving ? "move" : "copy", count, count, 0.0, 0 };
+
+	for (int i = 0; i < count; i++)
+		queue.enqueue(Event(ARRIVAL, times[i], 5));
+
+	BenchTimer timer;
+
+	if (moving) {
+		EventQueue moved(std::move(queue));
+		target = std::move(moved);
+	}
+	else {
+		EventQueue copied(queue);
+		target = copied;
+	}
+
+	timer.stop(result);
+
+	if (target.getElementCount() != count || (moving && !queue.isEmpty())) {
+		cerr << queueName << " lost elements when handed over" << endl;
+		exit(1);
+	}
+
+	if (moving && result.allocations != 0) {
+		cerr << queueName << " allocated " << result.allocations << " times when moved" << endl;
+		exit(1);
+	}
+
+	return result;
+}
+
+
+// Description: Removes the element with "handle" from an indexed queue
+template <class ElementType>
+bool removeByHandle(IndexedQueue<ElementType>& queue, int handle) {
+	return queue.remove(handle);
+}
+
+template <class ElementType>
+bool removeByHandle(IndexedHeapPriorityQueue<ElementType>& queue, int handle) {
+	return queue.cancel(handle);
+}
+
+
+// Description: Enqueues "count" events in random order, removes every other
+//				one by its handle and dequeues the rest. Exits with an error
+//				if a removal fails
+template <class IndexedEventQueue>
+BenchResult benchmarkCancel(const string& queueName, int count) {
+
+	vector<int> times = makeTimes("random", count);
+	vector<int> handles(count);
+	IndexedEventQueue queue;
+	BenchResult result = { "queue", queueName, "cancel half", count, 2LL * count, 0.0, 0 };
+
+	BenchTimer timer;
+
+	for (int i = 0; i < count; i++)
+		handles[i] = queue.enqueue(Event(ARRIVAL, times[i], 5));
+	for (int i = 0; i < count; i += 2) {
+		if (!removeByHandle(queue, handles[i])) {
+			cerr << queueName << " could not remove an element by its handle" << endl;
+			exit(1);
+		}
+	}
+	while (!queue.isEmpty())
+		queue.dequeue();
+
+	timer.stop(result);
+	return result;
+}
+
+
+// Description: Runs every workload on one queue type with "count" events,
+//				each in its own process; the hold model only if "hold"
+template <class EventQueue>
+void benchmarkQueue(const string& queueName, int count, bool hold = true) {
+
+	const char* workloads[] = { "sorted", "reverse", "random" };
+
+	if (hold)
+		runIsolated([&]() { return benchmarkHold<EventQueue>(queueName, count); });
+
+	for (int w = 0; w < 3; w++) {
+		string workload = workloads[w];
+		runIsolated([&]() { return benchmarkPreload<EventQueue>(queueName, workload, count); });
+	}
+
+	runIsolated([&]() { return benchmarkHandoff<EventQueue>(queueName, false, count); });
+	runIsolated([&]() { return benchmarkHandoff<EventQueue>(queueName, true, count); });
+}
+
+
+// Description: Runs the bulk workloads on one priority queue type with
+//				"count" events, each in its own process
+template <class EventQueue>
+void benchmarkBulkLoads(const string& queueName, int count) {
+
+	const char* workloads[] = { "sorted", "reverse", "random" };
+
+	for (int w = 0; w < 3; w++) {
+		string workload = workloads[w];
+		runIsolated([&]() { return benchmarkBulkLoad<EventQueue>(queueName, workload, count); });
+	}
+}
+
+
+int main() {
+
+	printBenchHeader();
+
+	for (int n = 100; n <= 10000000; n *= 10) {
+		benchmarkQueue< Queue<Event> >("Queue", n);
+		benchmarkQueue< IndexedQueue<Event> >("IndexedQueue", n);
+		runIsolated([&]() { return benchmarkCancel< IndexedQueue<Event> >("IndexedQueue", n); });
+		if (n <= LIST_LIMIT)
+			benchmarkQueue< PriorityQueue<Event> >("PriorityQueue", n, n <= LIST_HOLD_LIMIT);
+		benchmarkBulkLoads< PriorityQueue<Event> >("PriorityQueue", n);
+		benchmarkQueue< HeapPriorityQueue<Event> >("HeapPriorityQueue", n);
+		benchmarkBulkLoads< HeapPriorityQueue<Event> >("HeapPriorityQueue", n);
+		benchmarkQueue< IndexedHeapPriorityQueue<Event> >("IndexedHeapPriorityQueue", n);
+		runIsolated([&]() {
+			return benchmarkCancel< IndexedHeapPriorityQueue<Event> >("IndexedHeapPriorityQueue", n);
+		});
+		benchmarkQueue< RadixHeap<Event> >("RadixHeap", n);
+		benchmarkBulkLoads< RadixHeap<Event> >("RadixHeap", n);
+	}
+
+	return (failedBenchCases > 0) ? 1 : 0;
+}
@@ -0,0 +1,378 @@
+/*
+* RadixHeap.h
+*
+* Class Description: A monotone priority queue (radix heap) for elements
+*					 keyed by a non-negative integer time, as returned by
+*					 getTime(). It relies on the simulation property that
+*					 time never goes backward: no element may be enqueued
+*					 with a time earlier than that of the last element
+*					 dequeued. enqueue() refuses, returning "false", an
+*					 element with a negative time or one earlier than
+*					 that; callers must check, or the element is lost.
+*					 Elements are kept in 33 contiguous buckets. Bucket 0
+*					 holds elements whose time equals that of the last
+*					 element dequeued; bucket i > 0 holds elements whose time
+*					 first differs from it at bit i - 1. When bucket 0 is
+*					 empty, dequeue() redistributes the lowest non-empty
+*					 bucket around its earliest time, so each element moves
+*					 down at most 32 times.
+* Class Invariant: Every element is in the bucket given by its time and the
+*				   time of the last element dequeued. Elements of equal time
+*				   leave the queue in the order they entered it (FIFO), as
+*				   in PriorityQueue.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "EmptyDataCollectionException.h"
+
+using namespace std;
+
+template <class ElementType>
+class RadixHeap {
+
+	private:
+		static const int BUCKET_COUNT = 33;		// One per bit of the key, plus bucket 0
+
+		vector<ElementType> buckets[BUCKET_COUNT];	// Elements grouped by distance from lastTime
+		int bucketZeroFront;		// Index of the front element in bucket 0
+		unsigned int lastTime;		// Time of the last element dequeued
+		int elementCount;			// Total number of elements in queue
+
+		// Description: Returns the bucket for an element with the given time.
+		// Time Efficiency: O(1)
+		int bucketFor(unsigned int time) const;
+
+		// Description: Returns the lowest non-empty bucket above bucket 0 and
+		//				sets "earliest" to the index of its first earliest element.
+		// Precondition: Bucket 0 is empty and this queue is not empty.
+		// Time Efficiency: O(size of the bucket)
+		int findEarliest(int& earliest) const;
+
+	public:
+		// Default constructor
+		RadixHeap();
+
+		// Copy constructor and assignment operator copy every bucket
+		RadixHeap(const RadixHeap<ElementType>& aHeap) = default;
+		RadixHeap<ElementType>& operator=(const RadixHeap<ElementType>& aHeap) = default;
+
+		// Range constructor; enqueues every element from "first" to "last"
+		// Time Efficiency: O(n)
+		template <class InputIterator>
+		RadixHeap(InputIterator first, InputIterator last);
+
+		// Move constructor; "aHeap" is left empty
+		RadixHeap(RadixHeap<ElementType>&& aHeap);
+
+		// Move assignment operator; "aHeap" is left with this heap's old elements
+		RadixHeap<ElementType>& operator=(RadixHeap<ElementType>&& aHeap);
+
+		/******* Public Interface - START - *******/
+
+		// Description: Returns the number of elements in the Priority Queue.
+		// (This method eases testing.)
+		// Time Efficiency: O(1)
+		int getElementCount() const;
+
+		// Description: Returns "true" is this Priority Queue is empty, otherwise "false".
+		// Time Efficiency: O(1)
+		bool isEmpty() const;
+
+		// Description: Inserts newElement in priority order.
+		//              It returns "true" if successful, otherwise "false".
+		// Precondition: newElement's time is not negative and not earlier than
+		//				 the time of the last element dequeued.
+		// Time Efficiency: O(1)
+		bool enqueue(const ElementType& newElement);
+
+		// Description: Inserts every element from "first" to "last"; an
+		//				enqueue is already O(1), so this only saves the caller
+		//				a loop. It returns "true" if every element was inserted,
+		//				otherwise "false".
+		// Precondition: As for enqueue(), for every element.
+		// Time Efficiency: O(m) for m new elements
+		template <class InputIterator>
+		bool enqueueAll(InputIterator first, InputIterator last);
+
+		// Description: Removes the element with the "highest" priority.
+		//              It returns "true" if successful, otherwise "false".
+		// Precondition: This Priority Queue is not empty.
+		// Time Efficiency: O(log C) amortized, where C is the largest time
+		bool dequeue();
+
+		// Description: Returns (a copy of) the element with the "highest" priority.
+		// Precondition: This Priority Queue is not empty.
+		// Postcondition: This Priority Queue is unchanged.
+		// Exceptions: Throws EmptyDataCollectionException if this Priority Queue is empty.
+		// Time Efficiency: O(1) while elements share the front's time, otherwise
+		//					O(size of the bucket holding the front)
+		ElementType peek() const throw(EmptyDataCollectionException);
+
+		// Description: Prints the contents of the priority queue in priority order
+		// Postcondition: This Priority Queue is unchanged.
+		// Time Efficiency: O(n log C)
+		void printPriorityQueue();
+
+		// Description: Calls visit(element, rank) for every element, bucket
+		//				by bucket. Equal elements leave the queue in the
+		//				order of their ranks, so enqueuing every element in
+		//				rank order rebuilds this queue.
+		// Postcondition: This Priority Queue is unchanged.
+		// Time Efficiency: O(n)
+		template <class Visit>
+		void forEachEntry(Visit visit) const;
+
+		/******* Public Interface - END - *******/
+
+}; // end RadixHeap
+
+
+// Default constructor
+template <class ElementType>
+RadixHeap<ElementType>::RadixHeap() {
+	bucketZeroFront = 0;
+	lastTime = 0;
+	elementCount = 0;
+}
+
+
+// Range constructor; enqueues every element from "first" to "last"
+// Time Efficiency: O(n)
+template <class ElementType>
+template <class InputIterator>
+RadixHeap<ElementType>::RadixHeap(InputIterator first, InputIterator last) {
+	bucketZeroFront = 0;
+	lastTime = 0;
+	elementCount = 0;
+	enqueueAll(first, last);
+}
+
+
+// Move constructor; "aHeap" is left empty
+template <class ElementType>
+RadixHeap<ElementType>::RadixHeap(RadixHeap<ElementType>&& aHeap) {
+
+	// The buckets' arrays change owner; their elements are not copied
+	for (int i = 0; i < BUCKET_COUNT; i++)
+		buckets[i].swap(aHeap.buckets[i]);
+
+	bucketZeroFront = aHeap.bucketZeroFront;
+	lastTime = aHeap.lastTime;
+	elementCount = aHeap.elementCount;
+
+	aHeap.bucketZeroFront = 0;
+	aHeap.lastTime = 0;
+	aHeap.elementCount = 0;
+}
+
+
+// Move assignment operator; "aHeap" is left with this heap's old elements
+template <class ElementType>
+RadixHeap<ElementType>& RadixHeap<ElementType>::operator=(RadixHeap<ElementType>&& aHeap) {
+
+	if (this != &aHeap) {
+		for (int i = 0; i < BUCKET_COUNT; i++)
+			buckets[i].swap(aHeap.buckets[i]);
+
+		swap(bucketZeroFront, aHeap.bucketZeroFront);
+		swap(lastTime, aHeap.lastTime);
+		swap(elementCount, aHeap.elementCount);
+	}
+
+	return *this;
+}
+
+
+// Description: Returns the number of elements in the Priority Queue.
+// (This method eases testing.)
+// Time Efficiency: O(1)
+template <class ElementType>
+int RadixHeap<ElementType>::getElementCount() const {
+	return elementCount;
+}
+
+
+// Description: Returns "true" is this Priority Queue is empty, otherwise "false".
+// Time Efficiency: O(1)
+template <class ElementType>
+bool RadixHeap<ElementType>::isEmpty() const {
+	return elementCount == 0;
+}
+
+
+// Description: Inserts newElement in priority order.
+//              It returns "true" if successful, otherwise "false".
+// Precondition: newElement's time is not negative and not earlier than
+//				 the time of the last element dequeued.
+// Time Efficiency: O(1)
+template <class ElementType>
+bool RadixHeap<ElementType>::enqueue(const ElementType& newElement) {
+
+	// Enforce precondition that time never goes backward
+	if (newElement.getTime() < 0 || (unsigned int)newElement.getTime() < lastTime)
+		return false;
+
+	buckets[bucketFor(newElement.getTime())].push_back(newElement);
+	elementCount++;
+
+	return true;
+}
+
+
+// Description: Inserts every element from "first" to "last"; an
+//				enqueue is already O(1), so this only saves the caller
+//				a loop. It returns "true" if every element was inserted,
+//				otherwise "false".
+// Precondition: As for enqueue(), for every element.
+// Time Efficiency: O(m) for m new elements
+template <class ElementType>
+template <class InputIterator>
+bool RadixHeap<ElementType>::enqueueAll(InputIterator first, InputIterator last) {
+
+	bool allInserted = true;
+
+	for (; first != last; ++first) {
+		if (!enqueue(*first))
+			allInserted = false;
+	}
+
+	return allInserted;
+}
+
+
+// Description: Removes the element with the "highest" priority.
+//              It returns "true" if successful, otherwise "false".
+// Precondition: This Priority Queue is not empty.
+// Time Efficiency: O(log C) amortized, where C is the largest time
+template <class ElementType>
+bool RadixHeap<ElementType>::dequeue() {
+
+	if (isEmpty())
+		return false;
+
+	// Refill bucket 0 from the lowest non-empty bucket, around its earliest time.
+	// Every element of that bucket lands in a lower bucket; moving them in
+	// order keeps equal times in FIFO order
+	if (buckets[0].empty()) {
+		int earliest;
+		int lowest = findEarliest(earliest);
+		vector<ElementType>& source = buckets[lowest];
+
+		lastTime = source[earliest].getTime();
+		for (size_t i = 0; i < source.size(); i++)
+			buckets[bucketFor(source[i].getTime())].push_back(source[i]);
+		source.clear();
+	}
+
+	bucketZeroFront++;
+	elementCount--;
+
+	if (bucketZeroFront == (int)buckets[0].size()) {
+		buckets[0].clear();
+		bucketZeroFront = 0;
+	}
+
+	return true;
+}
+
+
+// Description: Returns (a copy of) the element with the "highest" priority.
+// Precondition: This Priority Queue is not empty.
+// Postcondition: This Priority Queue is unchanged.
+// Exceptions: Throws EmptyDataCollectionException if this Priority Queue is empty.
+// Time Efficiency: O(1) while elements share the front's time, otherwise
+//					O(size of the bucket holding the front)
+template <class ElementType>
+ElementType RadixHeap<ElementType>::peek() const throw(EmptyDataCollectionException) {
+
+	// Enforce precondition that queue is not empty
+	if (isEmpty())
+		throw EmptyDataCollectionException("peek() called with empty queue.");
+
+	if (!buckets[0].empty())
+		return buckets[0][bucketZeroFront];
+
+	int earliest;
+	int lowest = findEarliest(earliest);
+	return buckets[lowest][earliest];
+}
+
+
+// Description: Prints the contents of the priority queue in priority order
+// Postcondition: This Priority Queue is unchanged.
+// Time Efficiency: O(n log C)
+template <class ElementType>
+void RadixHeap<ElementType>::printPriorityQueue() {
+
+	RadixHeap<ElementType> copy(*this);
+
+	if (copy.isEmpty())
+		cout << endl << "Priority queue is empty" << endl;
+
+	while (!copy.isEmpty()) {
+		cout << copy.peek();
+		copy.dequeue();
+	}
+}
+
+
+// Description: Calls visit(element, rank) for every element, bucket by
+//				bucket. Equal elements leave the queue in the order of
+//				their ranks, so enqueuing every element in rank order
+//				rebuilds this queue.
+// Postcondition: This Priority Queue is unchanged.
+// Time Efficiency: O(n)
+template <class ElementType>
+template <class Visit>
+void RadixHeap<ElementType>::forEachEntry(Visit visit) const {
+
+	// Elements of equal time share a bucket, in the order they entered it
+	unsigned long long rank = 0;
+
+	for (size_t i = bucketZeroFront; i < buckets[0].size(); i++)
+		visit(buckets[0][i], rank++);
+	for (int bucket = 1; bucket < BUCKET_COUNT; bucket++) {
+		for (size_t i = 0; i < buckets[bucket].size(); i++)
+			visit(buckets[bucket][i], rank++);
+	}
+}
+
+
+// Description: Returns the bucket for an element with the given time.
+// Time Efficiency: O(1)
+template <class ElementType>
+int RadixHeap<ElementType>::bucketFor(unsigned int time) const {
+
+	if (time == lastTime)
+		return 0;
+
+	// Position of the highest bit at which time and lastTime differ, plus one
+	return 32 - __builtin_clz(time ^ lastTime);
+}
+
+
+// Description: Returns the lowest non-empty bucket above bucket 0 and
+//				sets "earliest" to the index of its first earliest element.
+// Precondition: Bucket 0 is empty and this queue is not empty.
+// Time Efficiency: O(size of the bucket)
+template <class ElementType>
+int RadixHeap<ElementType>::findEarliest(int& earliest) const {
+
+	int lowest = 1;
+	while (buckets[lowest].empty())
+		lowest++;
+
+	const vector<ElementType>& bucket = buckets[lowest];
+	earliest = 0;
+	for (int i = 1; i < (int)bucket.size(); i++) {
+		if (bucket[i].getTime() < bucket[earliest].getTime())
+			earliest = i;
+	}
+
+	return lowest;
+}
@@ -4,145 +4,858 @@
 * Class Description: A simulation of customers being served at a bank.
 *					 The simulation calculates average time spent waiting
 *					 in line for all customers.
-* Class Invariant: One teller serving one line of bank customers. All initial
-*				   inputs are customer arrival events.
+* Class Invariant: One or more tellers serving one shared line, or one line
+*				   per teller, of bank customers. All initial inputs are
+*				   customer arrival events.
 * Created on: June 20, 2017
 * Author: Andrew Adams
 */
 
 #include <iostream>
 #include <iomanip>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <climits>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
 #include "Event.h"
-#include "Queue.h"
+#include "ArrivalIterator.h"
+#include "BankSimulation.h"
+#include "ArrivalGenerator.h"
+#include "MonteCarlo.h"
+#include "ParameterSweep.h"
+#include "TraceReader.h"
+#include "BinaryTraceReader.h"
+#include "BinaryTraceWriter.h"
+#include "Checkpointer.h"
+#include "CheckpointReader.h"
+#include "EventLog.h"
+#include "SimulationStatistics.h"
 #include "PriorityQueue.h"
+#include "HeapPriorityQueue.h"
+#include "RadixHeap.h"
 
 using namespace std;
 
 
+// Options for replaying a trace
+struct ReplayOptions {
+	string queueType;				// Event priority queue implementation
+	int tellers;					// Number of tellers
+	LinePolicy linePolicy;			// How customers line up for the tellers
+	bool streaming;					// Read sorted arrivals as they are reached
+	double meanPatience;			// Mean patience of customers, or 0 for unlimited
+	int balkingLimit;				// Line length customers will not join, or 0 for none
+	vector<double> classWeights;	// Share of customers in each priority class
+	unsigned long long seed;		// Seed of the customers' patience and classes
+	EventLog* narration;			// Narration of every event, or NULL for none
+	BinaryTraceWriter* customerLog;	// Per-customer log, or NULL for none
+	ostream* statisticsDump;		// Statistics as JSON, or NULL for none
+	Checkpointer* checkpointer;		// Where checkpoints are saved, or NULL for none
+	long long checkpointInterval;	// Events between checkpoints
+	CheckpointReader* resumeFrom;	// Checkpoint to finish the run of, or NULL to start one
+};
+
+
+// Reads arrivals with another reader, stopping at the first with a
+// negative time or transaction length, which a RadixHeap cannot hold
+template <class ArrivalReader>
+class NonNegativeArrivals {
+
+	private:
+		ArrivalReader& trace;	// Reader of the arrivals
+		bool rejected;			// Whether an arrival was refused
+
+	public:
+		// Constructor
+		NonNegativeArrivals(ArrivalReader& arrivalTrace) : trace(arrivalTrace), rejected(false) {}
+
+		// Description: Reads the next arrival into "arrival", and returns
+		//				"false" at the end of the trace or at a negative one.
+		bool next(Event& arrival) {
+			if (rejected || !trace.next(arrival))
+				return false;
+			if (arrival.getTime() < 0 || arrival.getLength() < 0) {
+				rejected = true;
+				return false;
+			}
+			return true;
+		}
+
+		// Description: Returns "true" if an arrival was refused.
+		bool hasRejected() const {
+			return rejected;
+		}
+
+}; // end NonNegativeArrivals
+
+
+// Returns "true" if "trace" refused an arrival; only a NonNegativeArrivals can
+template <class ArrivalReader>
+bool arrivalsRejected(const ArrivalReader& trace) {
+	return false;
+}
+
+template <class ArrivalReader>
+bool arrivalsRejected(const NonNegativeArrivals<ArrivalReader>& trace) {
+	return trace.hasRejected();
+}
+
+
 // Declare functions used within main()
-void runSimulation(PriorityQueue<Event> eventPriorityQueue);
+template <class ArrivalReader>
+int replay(const ReplayOptions& options, ArrivalReader& trace);
+
+template <class EventQueue, class ArrivalReader>
+int simulate(const ReplayOptions& options, ArrivalReader& trace);
+
+template <class EventQueue, class ArrivalReader>
+int simulateSorted(const ReplayOptions& options, ArrivalReader& trace);
+
+template <class EventQueue>
+int finishReplay(const ReplayOptions& options, const BankSimulation<EventQueue>& simulation);
+
+void printFinalStatistics(const ReplayOptions& options, long long customers, float averageWait,
+	const SimulationStatistics& statistics);
+
+bool parseNumberList(const string& list, vector<double>& values);
+
+bool parseClassMix(const string& list, vector<double>& weights);
+
+template <class ArrivalReader>
+int sweep(ArrivalReader& trace, const vector<double>& tellerCounts, const vector<double>& serviceScales,
+	LinePolicy linePolicy, const CustomerBehavior& behavior, int threads);
+
+template <class ArrivalReader>
+void readArrivals(ArrivalReader& trace, vector<int>& arrivalTimes, vector<int>& transactionLengths);
+
+int simulateReplications(int replications, int customers, const vector<int>& arrivalTimes,
+	const vector<int>& transactionLengths, double meanInterarrival, double meanService,
+	int tellers, LinePolicy linePolicy, const CustomerBehavior& behavior, unsigned long long seed,
+	int threads);
+
+
+// Usage: sApp [-v] [--log-thread] [--queue=heap|radix|list] [--tellers=k]
+//		[--lines=shared|teller] [--stream] [--binary] [--log=file] [--stats=file]
+//		[--patience=x] [--balk=n] [--classes=w0,w1,...] [--seed=s]
+//		[--checkpoint=file] [--checkpoint-every=n] [--resume=file] < input
+// Only the final statistics are printed by default; "-v" (or "--verbose")
+// also narrates every event as it is processed. The narration is buffered,
+// and with "--log-thread" written by a background thread, so the
+// simulation does not wait for it to be output.
+// The event queue is a 4-ary heap by default; "radix" selects the monotone
+// radix heap and "list" the original sorted linked list. The radix heap
+// only holds times from 0 up, so with it an input with a negative arrival
+// time or transaction length is refused.
+// There is one teller by default. With several, customers wait in one shared
+// line by default, or with "--lines=teller" join the shortest of the tellers'
+// own lines.
+// With "--stream", arrivals are read as the simulation reaches them instead
+// of all up front, so memory does not grow with the length of the input;
+// the input must then be sorted by arrival time.
+// With "--binary", the input is a binary trace (see BinaryTraceFormat.h)
+// rather than text; "--log=file" writes a binary trace with one row per
+// customer: arrival time, service start, transaction length and teller.
+// The final statistics include waiting time percentiles, the average and
+// maximum line length and teller utilization; "--stats=file" also writes
+// them, with the waiting time histogram, to a file as JSON.
+// With "--patience=x", customers give up and leave the line if not served
+// within a patience drawn for each from an exponential distribution with
+// mean x (seeded with "--seed"); with "--balk=n", customers who would join a
+// line of n or more leave at once. Both are off by default, and the final
+// statistics then also count the customers who left.
+// With "--classes=w0,w1,...", customers come in up to 8 priority classes,
+// each arrival being class c with probability proportional to wc (seeded
+// with "--seed"); class 0 is served first, and the final statistics
+// include the waiting times of each class.
+// With "--checkpoint=file", the whole state of the run is saved to the file
+// every n events ("--checkpoint-every", 1000000 by default), replacing the
+// last checkpoint; saving happens in the background, and a crash while
+// saving leaves the previous checkpoint intact. A checkpoint that falls
+// due while the last is still being saved is skipped. "--resume=file" finishes
+// the run that saved the checkpoint, with the same results as if it had
+// never stopped. It must be given the same options; with "--stream" it
+// must also be given the same input, whose arrivals up to the checkpoint
+// are skipped, and without it the input is not read at all.
+//
+// Monte Carlo usage: sApp --replications=n [--customers=m] [--interarrival=x]
+//		[--service=y] [--empirical] [--seed=s] [--threads=t] [--tellers=k] [--lines=...]
+//		[--patience=x] [--balk=n] [--classes=w0,w1,...]
+// Runs n replications of m generated customers each, on t threads (all
+// cores by default), and reports the mean waiting time with a 95%
+// confidence interval. Arrivals are Poisson with mean gap x and exponential
+// transaction lengths with mean y, or with "--empirical" are resampled from
+// the trace on standard input (text, or binary with "--binary"). Runs whose
+// times would pass the largest int are refused. Patience, balking and
+// classes apply as in a replay, drawn from each replication's own stream,
+// and the mean number of customers who left is reported too.
+//
+// Sweep usage: sApp [--sweep-tellers=k1,k2,...] [--sweep-service=s1,s2,...]
+//		[--lines=...] [--threads=t] [--binary] [--patience=x] [--balk=n]
+//		[--classes=w0,w1,...] [--seed=s] < input
+// Replays the trace on standard input once for every combination of a
+// teller count k and a factor s that every transaction length is
+// multiplied by, on t threads (all cores by default), and prints one row
+// of statistics per combination. The trace is read once and shared by
+// every run. Either list defaults to the "--tellers" count or to 1.
+// Scaled lengths are rounded to whole minutes, at least 1, and a factor
+// that could take the clock past the largest int time is refused.
+// Patience, balking and classes apply as in a replay, seeded alike in
+// every run, and the rows then count the customers who left. Options of a
+// single replay ("-v", "--queue", "--stream", "--log", "--stats",
+// "--checkpoint" and "--resume") are refused with replications or sweeps.
+int main(int argc, char *argv[]) {
+
+	int verbosity = 0;				// 0 for the final statistics only, 1 to narrate events
+	bool logThread = false;			// Write the narration on a background thread
+	string queueType = "heap";		// Event priority queue implementation
+	string lineType = "shared";		// How customers line up for the tellers
+	int tellers = 1;				// Number of tellers
+	int replications = 0;			// Monte Carlo replications, or 0 to replay the input
+	int customers = 1000;			// Customers per replication
+	double meanInterarrival = 5.0;	// Mean gap between generated arrivals
+	double meanService = 4.0;		// Mean generated transaction length
+	bool empirical = false;			// Resample the input trace instead
+	unsigned long long seed = 225;	// Seed of the replications' random streams, and of patience
+	int threads = 0;				// Worker threads, or 0 for one per core
+	bool streaming = false;			// Read sorted arrivals as they are reached
+	bool binaryInput = false;		// Input is a binary trace
+	string logPath;					// File for the per-customer log, or empty
+	string statisticsPath;			// File for the statistics as JSON, or empty
+	double meanPatience = 0.0;		// Mean patience of customers, or 0 for unlimited
+	int balkingLimit = 0;			// Line length customers will not join, or 0 for none
+	vector<double> classWeights(1, 1.0);	// Share of customers in each priority class
+	vector<double> sweepTellers;	// Teller counts to sweep, or empty
+	vector<double> sweepScales;		// Transaction length factors to sweep, or empty
+	string checkpointPath;			// File checkpoints are saved to, or empty
+	long long checkpointInterval = 1000000;	// Events between checkpoints
+	string resumePath;				// Checkpoint to resume from, or empty
+
+	for (int i = 1; i < argc; i++) {
+		string option = argv[i];
+
+		if (option == "-v" || option == "--verbose")
+			verbosity = 1;
+		else if (option == "--log-thread")
+			logThread = true;
+		else if (option.compare(0, 8, "--queue=") == 0)
+			queueType = option.substr(8);
+		else if (option.compare(0, 10, "--tellers=") == 0)
+			tellers = atoi(option.substr(10).c_str());
+		else if (option.compare(0, 8, "--lines=") == 0)
+			lineType = option.substr(8);
+		else if (option.compare(0, 15, "--replications=") == 0)
+			replications = atoi(option.substr(15).c_str());
+		else if (option.compare(0, 12, "--customers=") == 0)
+			customers = atoi(option.substr(12).c_str());
+		else if (option.compare(0, 15, "--interarrival=") == 0)
+			meanInterarrival = atof(option.substr(15).c_str());
+		else if (option.compare(0, 10, "--service=") == 0)
+			meanService = atof(option.substr(10).c_str());
+		else if (option == "--stream")
+			streaming = true;
+		else if (option == "--binary")
+			binaryInput = true;
+		else if (option.compare(0, 6, "--log=") == 0)
+			logPath = option.substr(6);
+		else if (option.compare(0, 8, "--stats=") == 0)
+			statisticsPath = option.substr(8);
+		else if (option.compare(0, 11, "--patience=") == 0)
+			meanPatience = atof(option.substr(11).c_str());
+		else if (option.compare(0, 7, "--balk=") == 0)
+			balkingLimit = atoi(option.substr(7).c_str());
+		else if (option.compare(0, 10, "--classes=") == 0) {
+			if (!parseClassMix(option.substr(10), classWeights)) {
+				cerr << "Classes must be 1 to " << CUSTOMER_CLASS_COUNT
+					<< " non-negative weights with a positive sum" << endl;
+				return 1;
+			}
+		}
+		else if (option == "--empirical")
+			empirical = true;
+		else if (option.compare(0, 16, "--sweep-tellers=") == 0) {
+			if (!parseNumberList(option.substr(16), sweepTellers)) {
+				cerr << "Unreadable teller counts " << option.substr(16) << endl;
+				return 1;
+			}
+		}
+		else if (option.compare(0, 16, "--sweep-service=") == 0) {
+			if (!parseNumberList(option.substr(16), sweepScales)) {
+				cerr << "Unreadable service factors " << option.substr(16) << endl;
+				return 1;
+			}
+		}
+		else if (option.compare(0, 13, "--checkpoint=") == 0)
+			checkpointPath = option.substr(13);
+		else if (option.compare(0, 19, "--checkpoint-every=") == 0)
+			checkpointInterval = atoll(option.substr(19).c_str());
+		else if (option.compare(0, 9, "--resume=") == 0)
+			resumePath = option.substr(9);
+		else if (option.compare(0, 7, "--seed=") == 0)
+			seed = strtoull(option.substr(7).c_str(), NULL, 10);
+		else if (option.compare(0, 10, "--threads=") == 0)
+			threads = atoi(option.substr(10).c_str());
+		else {
+			cerr << "Unknown option " << option << endl;
+			return 1;
+		}
+	}
+
+	if (tellers < 1 || tellers > 65536) {
+		cerr << "Number of tellers must be between 1 and 65536" << endl;
+		return 1;
+	}
+
+	if (meanPatience < 0.0 || balkingLimit < 0) {
+		cerr << "Patience and balking limit must not be negative" << endl;
+		return 1;
+	}
+
+	if (checkpointInterval < 1) {
+		cerr << "Events between checkpoints must be positive" << endl;
+		return 1;
+	}
+
+	// Replications and sweeps run many simulations on the heap event queue
+	// and print only a summary, so options of a single replay would be
+	// silently ignored
+	if (replications > 0 || !sweepTellers.empty() || !sweepScales.empty()) {
+		string replayOnly;		// A replay option that was given, or empty
+
+		if (verbosity > 0 || logThread)
+			replayOnly = "-v";
+		else if (queueType != "heap")
+			replayOnly = "--queue";
+		else if (streaming)
+			replayOnly = "--stream";
+		else if (!logPath.empty())
+			replayOnly = "--log";
+		else if (!statisticsPath.empty())
+			replayOnly = "--stats";
+		else if (!checkpointPath.empty())
+			replayOnly = "--checkpoint";
+		else if (!resumePath.empty())
+			replayOnly = "--resume";
+
+		if (!replayOnly.empty()) {
+			cerr << replayOnly << " only applies to replaying a trace, not to replications or sweeps" << endl;
+			return 1;
+		}
+		if (replications > 0 && (!sweepTellers.empty() || !sweepScales.empty())) {
+			cerr << "Replications and sweeps cannot be combined" << endl;
+			return 1;
+		}
+	}
+
+	if (empirical && replications == 0) {
+		cerr << "--empirical only applies to replications" << endl;
+		return 1;
+	}
+
+	LinePolicy linePolicy;
+	if (lineType == "shared")
+		linePolicy = SHARED_LINE;
+	else if (lineType == "teller")
+		linePolicy = TELLER_LINES;
+	else {
+		cerr << "Unknown line type " << lineType << endl;
+		return 1;
+	}
+
+	CustomerBehavior behavior = { meanPatience, balkingLimit, classWeights, seed };
+
+	// Monte Carlo replications always use the heap event queue
+	if (replications > 0) {
+		if (customers < 1 || meanInterarrival <= 0.0 || meanService <= 0.0) {
+			cerr << "Customers and mean times must be positive" << endl;
+			return 1;
+		}
+
+		vector<int> arrivalTimes;		// Arrival times of the trace on standard input
+		vector<int> transactionLengths;	// Transaction lengths of the trace on standard input
+
+		if (empirical && binaryInput) {
+			BinaryTraceReader trace;
+			readArrivals(trace, arrivalTimes, transactionLengths);
+
+			if (trace.hasFailed()) {
+				cerr << "Cannot read input: " << trace.getError() << endl;
+				return 1;
+			}
+		}
+		else if (empirical) {
+			TraceReader trace;
+			readArrivals(trace, arrivalTimes, transactionLengths);
+		}
+
+		if (empirical && arrivalTimes.size() < 2) {
+			cerr << "An empirical distribution needs at least two customers" << endl;
+			return 1;
+		}
+
+		return simulateReplications(replications, customers, arrivalTimes, transactionLengths,
+			meanInterarrival, meanService, tellers, linePolicy, behavior, seed, threads);
+	}
+
+	// A sweep replays the input under every combination of its lists
+	if (!sweepTellers.empty() || !sweepScales.empty()) {
+		if (sweepTellers.empty())
+			sweepTellers.push_back(tellers);
+		if (sweepScales.empty())
+			sweepScales.push_back(1.0);
+
+		for (size_t i = 0; i < sweepTellers.size(); i++) {
+			if (sweepTellers[i] != (int)sweepTellers[i] || sweepTellers[i] < 1 || sweepTellers[i] > 65536) {
+				cerr << "Number of tellers must be between 1 and 65536" << endl;
+				return 1;
+			}
+		}
+		for (size_t i = 0; i < sweepScales.size(); i++) {
+			if (sweepScales[i] <= 0.0) {
+				cerr << "Service factors must be positive" << endl;
+				return 1;
+			}
+		}
+
+		int status = 0;
+
+		if (binaryInput) {
+			BinaryTraceReader trace;
+
+			if (!trace.hasFailed())
+				status = sweep(trace, sweepTellers, sweepScales, linePolicy, behavior, threads);
+			if (trace.hasFailed()) {
+				cerr << "Cannot read input: " << trace.getError() << endl;
+				return 1;
+			}
+		}
+		else {
+			TraceReader trace;
+			status = sweep(trace, sweepTellers, sweepScales, linePolicy, behavior, threads);
+		}
+		return status;
+	}
+
+	ReplayOptions options = { queueType, tellers, linePolicy, streaming, meanPatience, balkingLimit,
+		classWeights, seed, NULL, NULL, NULL, NULL, checkpointInterval, NULL };
+	ofstream statisticsFile;
+	int logFile = -1;
+	int status = 0;
+
+	if (!statisticsPath.empty()) {
+		statisticsFile.open(statisticsPath.c_str());
+		if (!statisticsFile) {
+			cerr << "Cannot open " << statisticsPath << endl;
+			return 1;
+		}
+		options.statisticsDump = &statisticsFile;
+	}
+
+	if (!logPath.empty()) {
+		logFile = open(logPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (logFile < 0) {
+			cerr << "Cannot open " << logPath << endl;
+			return 1;
+		}
+		options.customerLog = new BinaryTraceWriter(logFile, CUSTOMER_LOG_COLUMNS, CUSTOMER_LOG_COLUMN_COUNT);
+	}
+
+	if (!resumePath.empty()) {
+		options.resumeFrom = new CheckpointReader(resumePath);
+		if (options.resumeFrom->hasFailed()) {
+			cerr << "Cannot resume: " << options.resumeFrom->getError() << endl;
+			delete options.resumeFrom;
+			return 1;
+		}
+	}
+
+	if (!checkpointPath.empty())
+		options.checkpointer = new Checkpointer(checkpointPath);
+
+	if (verbosity > 0)
+		options.narration = new EventLog(STDOUT_FILENO, logThread);
+
+	// A checkpoint of a run that read its whole input holds every arrival
+	// it had not yet processed, so the input is not needed
+	if (options.resumeFrom && !streaming) {
+		TraceReader unread;
+		status = replay(options, unread);
+	}
+	else if (binaryInput) {
+		BinaryTraceReader trace;
+
+		if (!trace.hasFailed())
+			status = replay(options, trace);
+		if (trace.hasFailed()) {
+			cerr << "Cannot read input: " << trace.getError() << endl;
+			status = 1;
+		}
+	}
+	else {
+		TraceReader trace;
+		status = replay(options, trace);
+	}
+
+	if (options.narration) {
+		if (!options.narration->flush())
+			status = 1;
+		delete options.narration;
+	}
+
+	if (options.checkpointer) {
+		if (!options.checkpointer->finish()) {
+			cerr << "Cannot save checkpoint: " << options.checkpointer->getError() << endl;
+			status = 1;
+		}
+		delete options.checkpointer;
+	}
+
+	delete options.resumeFrom;
+
+	if (options.customerLog) {
+		if (!options.customerLog->finish()) {
+			cerr << "Cannot write " << logPath << endl;
+			status = 1;
+		}
+		delete options.customerLog;
+		close(logFile);
+	}
+
+	if (options.statisticsDump) {
+		statisticsFile.close();
+		if (!statisticsFile) {
+			cerr << "Cannot write " << statisticsPath << endl;
+			status = 1;
+		}
+	}
+
+	return status;
+}
 
 
-int main() {
+// Simulates the arrivals read by "trace" with the event queue selected by
+// the options, and returns the exit status
+template <class ArrivalReader>
+int replay(const ReplayOptions& options, ArrivalReader& trace) {
 
-	PriorityQueue<Event> eventPriorityQueue;	// Priority queue for storing arrival events
-	Event *arrivalEvent;						// A customer arrival event
-	int arrivalTime;							// Time each customer arrives at bank
-	int transactionLength;						// Time each customer spends with teller 
+	const string& queueType = options.queueType;
 
-	// While there is input, create arrival events based on input and populate priority queue
-	// with the arrival events
-	while(cin >> arrivalTime >> transactionLength) {
-		arrivalEvent = new Event("arrival", arrivalTime, transactionLength);
-		eventPriorityQueue.enqueue(*arrivalEvent);
-		delete arrivalEvent;
+	// The radix heap cannot hold times before 0 and would drop them, so
+	// its input is checked as it is read
+	if (queueType == "radix") {
+		NonNegativeArrivals<ArrivalReader> checkedTrace(trace);
+
+		if (options.streaming)
+			return simulateSorted< RadixHeap<Event> >(options, checkedTrace);
+		return simulate< RadixHeap<Event> >(options, checkedTrace);
+	}
+
+	if (options.streaming) {
+		if (queueType == "heap")
+			return simulateSorted< HeapPriorityQueue<Event> >(options, trace);
+		if (queueType == "list")
+			return simulateSorted< PriorityQueue<Event> >(options, trace);
+	}
+	else {
+		if (queueType == "heap")
+			return simulate< HeapPriorityQueue<Event> >(options, trace);
+		if (queueType == "list")
+			return simulate< PriorityQueue<Event> >(options, trace);
 	}
 
-	// Run simulation on priority queue of events
-	runSimulation(eventPriorityQueue);
+	cerr << "Unknown queue type " << queueType << endl;
+	return 1;
+}
+
+
+// Reads arrival events with "trace" into an event queue of the given type,
+// runs the simulation on it, or resumes it from the options' checkpoint,
+// prints the final statistics and returns the exit status
+template <class EventQueue, class ArrivalReader>
+int simulate(const ReplayOptions& options, ArrivalReader& trace) {
 
-	arrivalEvent = NULL;
-	delete arrivalEvent;
+	BankSimulation<EventQueue> simulation(options.tellers, options.linePolicy);
+
+	// Run simulation on priority queue of events, narrating each event if asked
+	simulation.setNarration(options.narration);
+	simulation.setCustomerLog(options.customerLog);
+	simulation.setPatience(options.meanPatience, options.seed);
+	simulation.setBalkingLimit(options.balkingLimit);
+	simulation.setClassMix(options.classWeights, options.seed);
+	simulation.setCheckpoints(options.checkpointer, options.checkpointInterval);
+
+	if (options.resumeFrom) {
+		if (!simulation.resume(*options.resumeFrom)) {
+			cerr << "Cannot resume: " << options.resumeFrom->getError() << endl;
+			return 1;
+		}
+	}
+	else {
+		// Build the priority queue from every arrival in the input at once,
+		// which is O(n) rather than an enqueue per arrival
+		EventQueue eventPriorityQueue((ArrivalIterator<ArrivalReader>(trace)), ArrivalIterator<ArrivalReader>());
+
+		if (arrivalsRejected(trace)) {
+			cerr << "Arrival times and transaction lengths must not be negative with --queue=radix" << endl;
+			return 1;
+		}
+		simulation.run(std::move(eventPriorityQueue));
+	}
+
+	return finishReplay(options, simulation);
+}
+
+
+// Simulates the arrivals read by "trace" as they are read, or resumes
+// the simulation from the options' checkpoint, prints the final
+// statistics and returns the exit status
+template <class EventQueue, class ArrivalReader>
+int simulateSorted(const ReplayOptions& options, ArrivalReader& trace) {
+
+	BankSimulation<EventQueue> simulation(options.tellers, options.linePolicy);
+
+	simulation.setNarration(options.narration);
+	simulation.setCustomerLog(options.customerLog);
+	simulation.setPatience(options.meanPatience, options.seed);
+	simulation.setBalkingLimit(options.balkingLimit);
+	simulation.setClassMix(options.classWeights, options.seed);
+	simulation.setCheckpoints(options.checkpointer, options.checkpointInterval);
+
+	bool sorted = options.resumeFrom ? simulation.resumeSorted(*options.resumeFrom, trace)
+		: simulation.runSorted(trace);
+
+	if (options.resumeFrom && options.resumeFrom->hasFailed()) {
+		cerr << "Cannot resume: " << options.resumeFrom->getError() << endl;
+		return 1;
+	}
+	if (arrivalsRejected(trace)) {
+		cerr << "Arrival times and transaction lengths must not be negative with --queue=radix" << endl;
+		return 1;
+	}
+	if (!sorted) {
+		cerr << "Arrivals are not sorted by time; run without --stream" << endl;
+		return 1;
+	}
+
+	return finishReplay(options, simulation);
+}
+
+
+// Prints the final statistics of "simulation", and returns the exit
+// status: 1 if its event queue refused a departure, so customers are
+// missing from the statistics
+template <class EventQueue>
+int finishReplay(const ReplayOptions& options, const BankSimulation<EventQueue>& simulation) {
+
+	printFinalStatistics(options, simulation.getCustomersProcessed(), simulation.getAverageWait(),
+		simulation.getStatistics());
+
+	if (simulation.getDeparturesRejected() > 0) {
+		cerr << simulation.getDeparturesRejected() << " departures were later than the event queue"
+			<< " can hold; those customers are missing from the statistics" << endl;
+		return 1;
+	}
 
 	return 0;
 }
 
 
-void runSimulation(PriorityQueue<Event> eventPriorityQueue) {
-
-	Queue<Event> bankLine;			// Queue for storing customers who must wait
-	Event *departureEvent;			// A departure event to track when each customer finishes with teller
-	Event currentCustomer;			// Customer at front of priority queue
-	int departureTime;				// Time each customer is finished with transaction
-	int currentTime;				// Current time of event simulation
-	int totalCustomers = 0;			// A running total of customers processed
-	int totalWaitTime = 0;			// A running total of time customers spent waiting in line
-	float avgWait = 0.0;			// The average wait time of all customers
-	bool tellerAvailable = true;	// Signifies if teller is available or not
-
-	// Run simulation loop until the priority queue of events is empty
-	cout << "Simulation Begins" << endl;
-	while (!eventPriorityQueue.isEmpty()) {
-
-		// Get current customer from front of priority queue
-		try {
-			currentCustomer = eventPriorityQueue.peek();
-		}
-		catch (EmptyDataCollectionException &anException) {
-			cout << "Simulation unsuccessful because " << anException.what() << endl;
-		}
-
-		// Set current time equal to time value of front customer event
-		currentTime = currentCustomer.getTime();
-
-		// Process event according to whether it is an arrival or departure
-		if (currentCustomer.getType() == "arrival") {
-			// Process arrival event
-			cout << "Processing an arrival event at time:\t" << setw(3) << currentTime << endl;
-
-			// Remove arrival from event priority queue
-			eventPriorityQueue.dequeue();
-
-			// If bank line is empty and teller is available, the arriving customer
-			// goes straight to the teller; calculate their departure time, add their
-			// wait time (which is zero) to the running total of wait times, and create
-			// a departure event based on when they will leave teller, then add this
-			// departure event to priority queue. If bank line is not empty, add
-			// arriving customer to the bank line
-			if (bankLine.isEmpty() && tellerAvailable) {
-				departureTime = currentTime + currentCustomer.getLength();
-				totalWaitTime += 0;
-				departureEvent = new Event("departure", departureTime, currentCustomer.getLength());
-				eventPriorityQueue.enqueue(*departureEvent);
-				delete departureEvent;
-				tellerAvailable = false;
-			} // end if
-			else
-				bankLine.enqueue(currentCustomer);
-		} // end if
-		else {
-			// Process departure event
-			cout << "Processing a departure event at time:\t" << setw(3) << departureTime << endl;
-
-			// Remove departure from event priority queue, and increment total customer count
-			eventPriorityQueue.dequeue();
-			totalCustomers++;
-
-			// If there are customers in the bank line, the front customer
-			// can now begin their transaction
-			if (!bankLine.isEmpty()) {
-
-				// Set current customer to customer at front of line, and dequeue from line
-				currentCustomer = bankLine.peek();
-				bankLine.dequeue();
-
-				// Calculate their time spent waiting and add it to running total
-				totalWaitTime += (currentTime - currentCustomer.getTime());
-
-				// Calculate their departure time, create a departure event, and add it to priority queue
-				departureTime = currentTime + currentCustomer.getLength();
-				departureEvent = new Event("departure", departureTime, currentCustomer.getLength());
-				eventPriorityQueue.enqueue(*departureEvent);
-				delete departureEvent;
-			} // end if
-			else {
-				// If there are no customers in line, then teller is available
-				tellerAvailable = true;
-			}
+// Prints the final statistics of a replay, and writes them as JSON if
+// the options ask for it
+void printFinalStatistics(const ReplayOptions& options, long long customers, float averageWait,
+	const SimulationStatistics& statistics) {
+
+	// The narration is written straight to standard output, so it has to be
+	// out before the statistics are printed
+	if (options.narration) {
+		options.narration->flush();
+		cout << endl;
+	}
+
+	cout << "Final Statistics:" << endl;
+	cout << "\tTotal number of people processed: " << customers << endl;
+	cout << "\tAverage amount of time spent waiting: " << averageWait << endl;
+	statistics.printReport(cout);
+	if (options.meanPatience > 0.0 || options.balkingLimit > 0)
+		cout << "\tCustomers who left unserved: " << statistics.getCustomersReneged() << " reneged, "
+			<< statistics.getCustomersBalked() << " balked" << endl;
+	if (options.classWeights.size() > 1)
+		statistics.printClassReport(cout);
+
+	if (options.statisticsDump)
+		statistics.writeJson(*options.statisticsDump);
+}
+
+
+// Reads a comma-separated list of numbers into "values", and returns
+// "false" if one is missing or not a number
+bool parseNumberList(const string& list, vector<double>& values) {
+
+	size_t start = 0;
+
+	values.clear();
+
+	while (true) {
+		size_t comma = list.find(',', start);
+		string value = list.substr(start, comma == string::npos ? string::npos : comma - start);
+		char* end;
+
+		values.push_back(strtod(value.c_str(), &end));
+		if (value.empty() || *end != '\0')
+			return false;
+
+		if (comma == string::npos)
+			return true;
+		start = comma + 1;
+	}
+}
+
+
+// Reads a comma-separated list of class weights into "weights", and
+// returns "false" if there are more than CUSTOMER_CLASS_COUNT, one is
+// negative or not a number, or they sum to zero
+bool parseClassMix(const string& list, vector<double>& weights) {
+
+	double sum = 0.0;
+
+	if (!parseNumberList(list, weights) || weights.size() > (size_t)CUSTOMER_CLASS_COUNT)
+		return false;
+
+	for (size_t i = 0; i < weights.size(); i++) {
+		if (weights[i] < 0.0)
+			return false;
+		sum += weights[i];
+	}
+
+	return sum > 0.0;
+}
+
+
+// Reads every arrival with "trace" once, sorts them by time if they are
+// not already, keeping ties in input order as the event queues do, and
+// replays them under every combination of tellerCounts and serviceScales,
+// printing a table of the results. Returns 1 without replaying if a service
+// factor could take the clock past INT_MAX, where times would overflow;
+// otherwise 0.
+template <class ArrivalReader>
+int sweep(ArrivalReader& trace, const vector<double>& tellerCounts, const vector<double>& serviceScales,
+	LinePolicy linePolicy, const CustomerBehavior& behavior, int threads) {
+
+	vector<Event> arrivals((ArrivalIterator<ArrivalReader>(trace)), ArrivalIterator<ArrivalReader>());
+	auto earlier = [](const Event& lhs, const Event& rhs) { return lhs.getTime() < rhs.getTime(); };
+
+	if (!is_sorted(arrivals.begin(), arrivals.end(), earlier))
+		stable_sort(arrivals.begin(), arrivals.end(), earlier);
+
+	// No run ends later than the last arrival plus every scaled transaction
+	// served one after another, as ScaledArrivals rounds them
+	for (size_t s = 0; s < serviceScales.size(); s++) {
+		double latestEnd = arrivals.empty() ? 0.0 : max(arrivals.back().getTime(), 0);
+
+		for (size_t i = 0; i < arrivals.size(); i++) {
+			if (arrivals[i].getLength() > 0)
+				latestEnd += max(floor(arrivals[i].getLength() * serviceScales[s] + 0.5), 1.0);
+		}
+		if (latestEnd > INT_MAX) {
+			cerr << "Service factor " << serviceScales[s]
+				<< " could run the simulation past the largest time it can hold" << endl;
+			return 1;
 		}
-	} // end while
+	}
 
-	cout << "Simulation Ends" << endl;
+	vector<SweepConfiguration> configurations;
+	for (size_t t = 0; t < tellerCounts.size(); t++) {
+		for (size_t s = 0; s < serviceScales.size(); s++) {
+			SweepConfiguration configuration = { (int)tellerCounts[t], serviceScales[s] };
+			configurations.push_back(configuration);
+		}
+	}
 
-	// Compute average waiting time of all customers
-	avgWait = (float)totalWaitTime / (float)totalCustomers;
+	vector<SweepResult> results = runSweep(arrivals, configurations, linePolicy, behavior, threads);
+	bool customersLeave = behavior.meanPatience > 0.0 || behavior.balkingLimit > 0;
 
-	// Print final statistics
-	cout << endl << "Final Statistics:" << endl;
-	cout << "\tTotal number of people processed: " << totalCustomers << endl;
-	cout << "\tAverage amount of time spent waiting: " << avgWait << endl;
+	cout << "Parameter Sweep" << endl;
+	cout << "\tCustomers: " << arrivals.size() << endl;
+	cout << "\tConfigurations: " << configurations.size() << endl << endl;
+
+	cout << fixed << setprecision(2);
+	cout << setw(8) << "tellers" << setw(9) << "service" << setw(11) << "served"
+		<< setw(12) << "avg wait" << setw(9) << "p50" << setw(9) << "p90" << setw(9) << "p99"
+		<< setw(9) << "max" << setw(10) << "avg line" << setw(13) << "utilization";
+	if (customersLeave)
+		cout << setw(9) << "reneged" << setw(8) << "balked";
+	cout << endl;
+
+	for (size_t i = 0; i < results.size(); i++) {
+		const SweepResult& result = results[i];
+
+		cout << setw(8) << result.configuration.tellers << setw(9) << result.configuration.serviceScale
+			<< setw(11) << result.customers << setw(12) << result.averageWait
+			<< setw(9) << result.waitP50 << setw(9) << result.waitP90 << setw(9) << result.waitP99
+			<< setw(9) << result.maxWait << setw(10) << result.averageLineLength
+			<< setw(12) << result.utilization * 100.0 << "%";
+		if (customersLeave)
+			cout << setw(9) << result.customersReneged << setw(8) << result.customersBalked;
+		cout << endl;
+	}
 
-	departureEvent = NULL;
-	delete departureEvent;
+	return 0;
 }
 
+
+// Reads every arrival with "trace" into arrivalTimes and transactionLengths
+template <class ArrivalReader>
+void readArrivals(ArrivalReader& trace, vector<int>& arrivalTimes, vector<int>& transactionLengths) {
+
+	Event arrival;
+
+	while (trace.next(arrival)) {
+		arrivalTimes.push_back(arrival.getTime());
+		transactionLengths.push_back(arrival.getLength());
+	}
+}
+
+
+// Runs Monte Carlo replications on generated arrivals and prints the
+// mean waiting time with its 95% confidence interval. Arrivals are
+// resampled from arrivalTimes and transactionLengths if they are not empty.
+// Returns 1, printing only an error, if a replication's times would pass
+// INT_MAX; otherwise 0.
+int simulateReplications(int replications, int customers, const vector<int>& arrivalTimes,
+	const vector<int>& transactionLengths, double meanInterarrival, double meanService,
+	int tellers, LinePolicy linePolicy, const CustomerBehavior& behavior, unsigned long long seed,
+	int threads) {
+
+	ArrivalGenerator generator = !arrivalTimes.empty()
+		? ArrivalGenerator(arrivalTimes, transactionLengths)
+		: ArrivalGenerator(meanInterarrival, meanService);
+
+	MonteCarloResult result = runReplications(generator, replications, customers,
+		tellers, linePolicy, behavior, seed, threads);
+
+	if (result.timesOverflowed) {
+		cerr << "Replications of " << customers << " customers run past the largest time"
+			<< " the simulation can hold; use fewer customers or shorter mean times" << endl;
+		return 1;
+	}
+
+	cout << "Monte Carlo Simulation" << endl;
+	cout << "\tReplications: " << result.replications << endl;
+	cout << "\tCustomers per replication: " << customers << endl;
+	cout << "\tTellers: " << tellers << endl;
+
+	cout << endl << "Final Statistics:" << endl;
+	cout << "\tMean of average waiting times: " << result.meanWait << endl;
+	cout << "\tStandard deviation: " << result.standardDeviation << endl;
+	cout << "\t95% confidence interval: [" << result.meanWait - result.halfWidth
+		<< ", " << result.meanWait + result.halfWidth << "]" << endl;
+	if (behavior.meanPatience > 0.0 || behavior.balkingLimit > 0)
+		cout << "\tMean customers who left unserved: " << result.meanReneged << " reneged, "
+			<< result.meanBalked << " balked" << endl;
+
+	return 0;
+}
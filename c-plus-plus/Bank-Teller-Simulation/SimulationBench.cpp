@@ -0,0 +1,222 @@
+/*
+* SimulationBench.cpp
+*
+* Class Description: Benchmarks whole simulations on generated traces of
+*					 10^3 to 10^7 Poisson arrivals, with each event priority
+*					 queue, for one teller and for eight tellers with a
+*					 shared line or a line each, all at a load of 0.8 to
+*					 0.9, and for eight tellers with customers who renege
+*					 after an exponential patience with mean 60 or who come
+*					 in three priority classes, a fifth, a third and the
+*					 rest of arrivals, and for eight tellers watched by an
+*					 observer that keeps hourly arrival counts and line
+*					 lengths, to set against the default NullObserver.
+*					 "preload" builds the event queue from every arrival at
+*					 once and then runs the simulation, as SimulationApp
+*					 does by default; "stream"
+*					 merges the sorted arrivals with the departures, as
+*					 with --stream. The trace is generated before timing.
+*					 Output is CSV (see BenchHarness.h); each arrival and
+*					 each departure processed is one operation, so
+*					 ops_per_second is events per second.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <iostream>
+#include <string>
+#include <random>
+#include <vector>
+#include "Event.h"
+#include "ArrivalGenerator.h"
+#include "BankSimulation.h"
+#include "PriorityQueue.h"
+#include "HeapPriorityQueue.h"
+#include "RadixHeap.h"
+#include "BenchHarness.h"
+
+using namespace std;
+
+
+// Largest trace the O(n) linked list is benchmarked with
+const int LIST_LIMIT = 10000;
+
+// Mean time between generated arrivals
+const double MEAN_INTERARRIVAL = 5.0;
+
+
+// A simulation configuration
+struct Scenario {
+	string name;			// Name in the workload column
+	int tellers;			// Number of tellers
+	LinePolicy linePolicy;	// How customers line up
+	double meanService;		// Mean generated transaction length
+	double meanPatience;	// Mean patience of customers, or 0 for unlimited
+	vector<double> classWeights;	// Share of customers in each priority class
+	bool observed;			// Whether an HourlyObserver watches the run
+};
+
+
+// Length of an hour, in simulation time units
+const int HOUR = 3600;
+
+
+// An observer (see SimulationObserver.h) that counts the arrivals in each
+// hour and the longest any line grew in it
+class HourlyObserver : public NullObserver {
+
+	private:
+		int currentTime;				// Time of the latest event
+		vector<long long> arrivals;		// Arrivals in each hour
+		vector<int> longestLine;		// Longest line in each hour
+
+		// Description: Returns the index of the current hour, adding hours
+		//				as the clock reaches them.
+		size_t currentHour() {
+			size_t hour = currentTime / HOUR;
+			if (hour >= arrivals.size()) {
+				arrivals.resize(hour + 1, 0);
+				longestLine.resize(hour + 1, 0);
+			}
+			return hour;
+		}
+
+	public:
+		void reset(int tellers) {
+			currentTime = 0;
+			arrivals.clear();
+			longestLine.clear();
+		}
+
+		void advanceTo(int time) {
+			currentTime = time;
+		}
+
+		void customerArrived(const Event& customer) {
+			arrivals[currentHour()]++;
+		}
+
+		void lineLengthChanged(int line, int previousLength, int length) {
+			size_t hour = currentHour();
+			if (length > longestLine[hour])
+				longestLine[hour] = length;
+		}
+
+}; // end HourlyObserver
+
+
+// Collects generated arrivals in a vector, in the order generated
+class ArrivalList {
+
+	private:
+		vector<Event>& arrivals;	// Where arrivals are collected
+		size_t position;			// Index of the next arrival next() returns
+
+	public:
+		// Constructor
+		ArrivalList(vector<Event>& arrivalEvents) : arrivals(arrivalEvents), position(0) {}
+
+		// Description: Appends "arrival", as ArrivalGenerator::generate() does.
+		void enqueue(const Event& arrival) {
+			arrivals.push_back(arrival);
+		}
+
+		// Description: Reads the next arrival, as BankSimulation::runSorted() does.
+		bool next(Event& arrival) {
+			if (position == arrivals.size())
+				return false;
+			arrival = arrivals[position++];
+			return true;
+		}
+
+}; // end ArrivalList
+
+
+// Description: Generates "customers" arrivals for "scenario" and simulates
+//				them with the event queue and observer types, preloaded or
+//				streamed
+template <class EventQueue, class Observer>
+BenchResult benchmarkSimulation(const string& queueName, const Scenario& scenario,
+	bool streaming, int customers) {
+
+	ArrivalGenerator generator(MEAN_INTERARRIVAL, scenario.meanService);
+	mt19937_64 randomEngine(225);
+	vector<Event> arrivals;
+	ArrivalList arrivalList(arrivals);
+	BankSimulation<EventQueue, Observer> simulation(scenario.tellers, scenario.linePolicy);
+	simulation.setPatience(scenario.meanPatience, 225);
+	simulation.setClassMix(scenario.classWeights, 225);
+	BenchResult result = { "simulation", queueName, (streaming ? "stream " : "preload ") + scenario.name,
+		customers, 2LL * customers, 0.0, 0 };
+
+	arrivals.reserve(customers);
+	generator.generate(arrivalList, customers, randomEngine);
+
+	BenchTimer timer;
+
+	if (streaming)
+		simulation.runSorted(arrivalList);
+	else {
+		EventQueue eventPriorityQueue(arrivals.begin(), arrivals.end());
+		simulation.run(std::move(eventPriorityQueue));
+	}
+
+	timer.stop(result);
+
+	if (simulation.getCustomersProcessed() + simulation.getStatistics().getCustomersReneged() != customers)
+		cerr << "Simulation did not serve every customer" << endl;
+
+	return result;
+}
+
+
+// Description: Runs every scenario, preloaded and streamed, with one event
+//				queue type and "customers" customers, each in its own process
+template <class EventQueue>
+void benchmarkQueue(const string& queueName, const vector<Scenario>& scenarios, int customers) {
+
+	for (size_t s = 0; s < scenarios.size(); s++) {
+		const Scenario& scenario = scenarios[s];
+
+		if (scenario.observed) {
+			runIsolated([&]() { return benchmarkSimulation<EventQueue, HourlyObserver>(queueName, scenario, false, customers); });
+			runIsolated([&]() { return benchmarkSimulation<EventQueue, HourlyObserver>(queueName, scenario, true, customers); });
+		}
+		else {
+			runIsolated([&]() { return benchmarkSimulation<EventQueue, NullObserver>(queueName, scenario, false, customers); });
+			runIsolated([&]() { return benchmarkSimulation<EventQueue, NullObserver>(queueName, scenario, true, customers); });
+		}
+	}
+}
+
+
+int main() {
+
+	vector<Scenario> scenarios;
+	vector<double> oneClass(1, 1.0);
+	vector<double> threeClasses = { 3.0, 5.0, 7.0 };
+	Scenario oneTeller = { "k=1 shared", 1, SHARED_LINE, 4.0, 0.0, oneClass, false };
+	Scenario sharedLine = { "k=8 shared", 8, SHARED_LINE, 36.0, 0.0, oneClass, false };
+	Scenario tellerLines = { "k=8 teller", 8, TELLER_LINES, 36.0, 0.0, oneClass, false };
+	Scenario reneging = { "k=8 shared reneging", 8, SHARED_LINE, 36.0, 60.0, oneClass, false };
+	Scenario classes = { "k=8 shared 3 classes", 8, SHARED_LINE, 36.0, 0.0, threeClasses, false };
+	Scenario observed = { "k=8 shared observed", 8, SHARED_LINE, 36.0, 0.0, oneClass, true };
+
+	scenarios.push_back(oneTeller);
+	scenarios.push_back(sharedLine);
+	scenarios.push_back(tellerLines);
+	scenarios.push_back(reneging);
+	scenarios.push_back(classes);
+	scenarios.push_back(observed);
+
+	printBenchHeader();
+
+	for (int n = 1000; n <= 10000000; n *= 10) {
+		if (n <= LIST_LIMIT)
+			benchmarkQueue< PriorityQueue<Event> >("PriorityQueue", scenarios, n);
+		benchmarkQueue< HeapPriorityQueue<Event> >("HeapPriorityQueue", scenarios, n);
+		benchmarkQueue< RadixHeap<Event> >("RadixHeap", scenarios, n);
+	}
+
+	return (failedBenchCases > 0) ? 1 : 0;
+}
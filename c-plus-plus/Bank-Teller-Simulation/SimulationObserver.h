@@ -0,0 +1,112 @@
+/*
+* SimulationObserver.h
+*
+* Class Description: Observers of a BankSimulation's event loop. The
+*					 simulation calls an observer's hooks as customers
+*					 arrive, wait, are served and leave, so custom metrics
+*					 can be gathered without changing the engine. An
+*					 observer is any class with these methods, each called
+*					 at the time of the latest advanceTo():
+*						 void reset(int tellers)
+*							 before a run with "tellers" tellers starts or
+*							 resumes
+*						 void advanceTo(int time)
+*							 when the clock moves to the time of the next
+*							 event or reneging; times never decrease
+*						 void customerArrived(const Event& customer)
+*							 for every arrival, with its class drawn
+*						 void customerBalked(const Event& customer)
+*							 when an arrival will not join a line
+*						 void lineLengthChanged(int line, int previousLength, int length)
+*							 when a customer joins or leaves a line, which
+*							 is 0 for the shared line or else the teller's
+*						 void customerReneged(const Event& customer)
+*							 when a customer leaves a line unserved, after
+*							 the line's lineLengthChanged()
+*						 void serviceStarted(const Event& customer, int teller, int time)
+*							 when "teller" starts serving "customer" at "time"
+*						 void customerDeparted(const Event& departure)
+*							 when a teller finishes with a customer; the
+*							 departure holds its time and teller
+*					 The observer is a template parameter of the engine,
+*					 not a virtual interface, so every hook is resolved at
+*					 compile time and can be inlined. NullObserver, the
+*					 default, does nothing, and its empty hooks compile away
+*					 to leave the event loop as fast as without an
+*					 observer. SimulationStatistics is itself an observer,
+*					 which the engine always runs; ObserverPair runs it
+*					 alongside the engine's Observer.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include "Event.h"
+
+using namespace std;
+
+// An observer that ignores every hook
+class NullObserver {
+
+	public:
+		void reset(int tellers) {}
+		void advanceTo(int time) {}
+		void customerArrived(const Event& customer) {}
+		void customerBalked(const Event& customer) {}
+		void lineLengthChanged(int line, int previousLength, int length) {}
+		void customerReneged(const Event& customer) {}
+		void serviceStarted(const Event& customer, int teller, int time) {}
+		void customerDeparted(const Event& departure) {}
+
+}; // end NullObserver
+
+
+// An observer that calls the hooks of "first", then of "second"
+template <class First, class Second>
+class ObserverPair {
+
+	public:
+		First first;		// Observer whose hooks are called first
+		Second second;		// Observer whose hooks are called second
+
+		void reset(int tellers) {
+			first.reset(tellers);
+			second.reset(tellers);
+		}
+
+		void advanceTo(int time) {
+			first.advanceTo(time);
+			second.advanceTo(time);
+		}
+
+		void customerArrived(const Event& customer) {
+			first.customerArrived(customer);
+			second.customerArrived(customer);
+		}
+
+		void customerBalked(const Event& customer) {
+			first.customerBalked(customer);
+			second.customerBalked(customer);
+		}
+
+		void lineLengthChanged(int line, int previousLength, int length) {
+			first.lineLengthChanged(line, previousLength, length);
+			second.lineLengthChanged(line, previousLength, length);
+		}
+
+		void customerReneged(const Event& customer) {
+			first.customerReneged(customer);
+			second.customerReneged(customer);
+		}
+
+		void serviceStarted(const Event& customer, int teller, int time) {
+			first.serviceStarted(customer, teller, time);
+			second.serviceStarted(customer, teller, time);
+		}
+
+		void customerDeparted(const Event& departure) {
+			first.customerDeparted(departure);
+			second.customerDeparted(departure);
+		}
+
+}; // end ObserverPair
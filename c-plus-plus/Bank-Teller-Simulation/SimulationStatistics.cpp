@@ -0,0 +1,417 @@
+/*
+* SimulationStatistics.cpp
+*
+* Class Description: Statistics of one run of the bank simulation, kept in
+*					 fixed memory and O(1) time per event.
+* Class Invariant: totalWaitTime is the sum of classWaitTime.
+*				   waitingArea and busyArea are the integrals, up to
+*				   currentTime, of the number of customers in line and of
+*				   the number of busy tellers.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <iomanip>
+#include "SimulationStatistics.h"
+#include "CheckpointWriter.h"
+#include "CheckpointReader.h"
+
+using namespace std;
+
+
+// Constructor
+SimulationStatistics::SimulationStatistics(int tellers) {
+	reset(tellers);
+}
+
+
+// Description: Clears the statistics for a new run with "tellers" tellers.
+// Time Efficiency: O(histogram buckets)
+void SimulationStatistics::reset(int tellers) {
+
+	tellerCount = tellers;
+
+	// Only the classes that had customers need their buckets cleared
+	for (int i = 0; i < CUSTOMER_CLASS_COUNT; i++) {
+		if (classWaits[i].getCount() > 0)
+			classWaits[i].clear();
+		classWaitTime[i] = 0;
+	}
+
+	customersServed = 0;
+	totalWaitTime = 0;
+	customersReneged = 0;
+	customersBalked = 0;
+
+	started = false;
+	startTime = 0;
+	currentTime = 0;
+	waiting = 0;
+	busy = 0;
+	maxLineLength = 0;
+	waitingArea = 0;
+	busyArea = 0;
+}
+
+
+// Description: Moves the clock to the time of the event being processed.
+// Precondition: time is no earlier than the previous event's.
+// Time Efficiency: O(1)
+void SimulationStatistics::advanceTo(int time) {
+
+	if (!started) {
+		started = true;
+		startTime = time;
+	}
+	else {
+		// The line lengths and busy tellers have held since the last event
+		long long interval = (long long)time - currentTime;
+		waitingArea += waiting * interval;
+		busyArea += busy * interval;
+	}
+
+	currentTime = time;
+}
+
+
+// Description: Records a customer leaving without joining a line.
+// Time Efficiency: O(1)
+void SimulationStatistics::customerBalked(const Event& customer) {
+	customersBalked++;
+}
+
+
+// Description: Records a customer joining or leaving "line", which
+//				held "previousLength" customers and now holds "length".
+// Time Efficiency: O(1)
+void SimulationStatistics::lineLengthChanged(int line, int previousLength, int length) {
+
+	waiting += length - previousLength;
+	if (length > maxLineLength)
+		maxLineLength = length;
+}
+
+
+// Description: Records a customer leaving a line unserved.
+// Time Efficiency: O(1)
+void SimulationStatistics::customerReneged(const Event& customer) {
+	customersReneged++;
+}
+
+
+// Description: Records "teller" starting to serve "customer" at "time",
+//				after they waited in line since their arrival.
+// Time Efficiency: O(1)
+void SimulationStatistics::serviceStarted(const Event& customer, int teller, int time) {
+
+	int waitTime = time - customer.getTime();
+	int customerClass = customer.getCustomerClass();
+
+	busy++;
+	totalWaitTime += waitTime;
+	classWaitTime[customerClass] += waitTime;
+	classWaits[customerClass].record(waitTime);
+}
+
+
+// Description: Records a teller finishing with a customer.
+// Time Efficiency: O(1)
+void SimulationStatistics::customerDeparted(const Event& departure) {
+
+	busy--;
+	customersServed++;
+}
+
+
+// Description: Returns the number of customers whose service has ended.
+// Time Efficiency: O(1)
+long long SimulationStatistics::getCustomersServed() const {
+	return customersServed;
+}
+
+
+// Description: Returns the total time customers spent waiting in line.
+// Time Efficiency: O(1)
+long long SimulationStatistics::getTotalWaitTime() const {
+	return totalWaitTime;
+}
+
+
+// Description: Returns the number of customers who left a line unserved.
+// Time Efficiency: O(1)
+long long SimulationStatistics::getCustomersReneged() const {
+	return customersReneged;
+}
+
+
+// Description: Returns the number of customers who would not join a line.
+// Time Efficiency: O(1)
+long long SimulationStatistics::getCustomersBalked() const {
+	return customersBalked;
+}
+
+
+// Description: Returns the average time customers spent waiting in line.
+// Time Efficiency: O(1)
+float SimulationStatistics::getAverageWait() const {
+	return (float)totalWaitTime / (float)customersServed;
+}
+
+
+// Description: Returns the waiting time that "percentile" percent of
+//				customers waited no longer than, within 1/64.
+// Precondition: percentile is between 0 and 100.
+// Time Efficiency: O(histogram buckets * classes)
+int SimulationStatistics::getWaitAtPercentile(double percentile) const {
+	return allWaits().getValueAtPercentile(percentile);
+}
+
+
+// Description: Returns the longest time a customer waited in line.
+// Time Efficiency: O(classes)
+int SimulationStatistics::getMaxWait() const {
+
+	int maxWait = 0;
+
+	for (int i = 0; i < CUSTOMER_CLASS_COUNT; i++) {
+		if (classWaits[i].getMaximum() > maxWait)
+			maxWait = classWaits[i].getMaximum();
+	}
+
+	return maxWait;
+}
+
+
+// Description: Returns the number of customers of class
+//				"customerClass" whose service has started.
+// Time Efficiency: O(1)
+long long SimulationStatistics::getClassCustomers(int customerClass) const {
+	return classWaits[customerClass].getCount();
+}
+
+
+// Description: Returns the average time customers of class
+//				"customerClass" spent waiting in line.
+// Time Efficiency: O(1)
+double SimulationStatistics::getClassAverageWait(int customerClass) const {
+
+	if (classWaits[customerClass].getCount() == 0)
+		return 0.0;
+
+	return (double)classWaitTime[customerClass] / classWaits[customerClass].getCount();
+}
+
+
+// Description: Returns the waiting time that "percentile" percent of
+//				customers of class "customerClass" waited no longer
+//				than, within 1/64.
+// Precondition: percentile is between 0 and 100.
+// Time Efficiency: O(histogram buckets)
+int SimulationStatistics::getClassWaitAtPercentile(int customerClass, double percentile) const {
+	return classWaits[customerClass].getValueAtPercentile(percentile);
+}
+
+
+// Description: Returns the longest time a customer of class
+//				"customerClass" waited in line.
+// Time Efficiency: O(1)
+int SimulationStatistics::getClassMaxWait(int customerClass) const {
+	return classWaits[customerClass].getMaximum();
+}
+
+
+// Description: Returns the time from the first event to the last.
+// Time Efficiency: O(1)
+int SimulationStatistics::getElapsedTime() const {
+	return currentTime - startTime;
+}
+
+
+// Description: Returns the time-weighted average number of customers
+//				in line, over all lines.
+// Time Efficiency: O(1)
+double SimulationStatistics::getAverageLineLength() const {
+
+	if (getElapsedTime() == 0)
+		return 0.0;
+
+	return (double)waitingArea / getElapsedTime();
+}
+
+
+// Description: Returns the most customers any one line has held.
+// Time Efficiency: O(1)
+int SimulationStatistics::getMaxLineLength() const {
+	return maxLineLength;
+}
+
+
+// Description: Returns the fraction of time the tellers were busy.
+// Time Efficiency: O(1)
+double SimulationStatistics::getUtilization() const {
+
+	if (getElapsedTime() == 0)
+		return 0.0;
+
+	return (double)busyArea / ((double)tellerCount * getElapsedTime());
+}
+
+
+// Description: Writes the waiting time percentiles, line lengths and
+//				utilization, one per tab-indented line, for the final
+//				report.
+// Time Efficiency: O(histogram buckets * classes)
+void SimulationStatistics::printReport(ostream& os) const {
+
+	WaitHistogram waits = allWaits();
+
+	os << "\tWaiting time percentiles (p50/p90/p99/max): " << waits.getValueAtPercentile(50.0)
+		<< " / " << waits.getValueAtPercentile(90.0) << " / " << waits.getValueAtPercentile(99.0)
+		<< " / " << waits.getMaximum() << endl;
+	os << "\tTime-weighted average line length: " << getAverageLineLength() << endl;
+	os << "\tMaximum line length: " << getMaxLineLength() << endl;
+	os << "\tTeller utilization: " << getUtilization() * 100.0 << "%" << endl;
+}
+
+
+// Description: Writes the number served, average wait and waiting
+//				time percentiles of each class with customers, one
+//				per tab-indented line.
+// Time Efficiency: O(histogram buckets * classes)
+void SimulationStatistics::printClassReport(ostream& os) const {
+
+	for (int i = 0; i < CUSTOMER_CLASS_COUNT; i++) {
+		if (getClassCustomers(i) == 0)
+			continue;
+
+		os << "\tClass " << i << ": " << getClassCustomers(i) << " served, average wait "
+			<< getClassAverageWait(i) << ", percentiles (p50/p90/p99/max): "
+			<< getClassWaitAtPercentile(i, 50.0) << " / " << getClassWaitAtPercentile(i, 90.0)
+			<< " / " << getClassWaitAtPercentile(i, 99.0) << " / " << getClassMaxWait(i) << endl;
+	}
+}
+
+
+// Description: Writes every statistic, those of each class with
+//				customers, and the non-empty buckets of the waiting
+//				time histogram, as a JSON object.
+// Time Efficiency: O(histogram buckets * classes)
+void SimulationStatistics::writeJson(ostream& os) const {
+
+	streamsize precision = os.precision(10);
+	WaitHistogram waits = allWaits();
+	bool firstClass = true;
+
+	os << "{" << endl;
+	os << "  \"tellers\": " << tellerCount << "," << endl;
+	os << "  \"customers\": " << customersServed << "," << endl;
+	os << "  \"total_wait\": " << totalWaitTime << "," << endl;
+	os << "  \"reneged\": " << customersReneged << "," << endl;
+	os << "  \"balked\": " << customersBalked << "," << endl;
+	os << "  \"average_wait\": " << (customersServed ? (double)totalWaitTime / customersServed : 0.0) << "," << endl;
+	os << "  \"wait_p50\": " << waits.getValueAtPercentile(50.0) << "," << endl;
+	os << "  \"wait_p90\": " << waits.getValueAtPercentile(90.0) << "," << endl;
+	os << "  \"wait_p99\": " << waits.getValueAtPercentile(99.0) << "," << endl;
+	os << "  \"wait_max\": " << waits.getMaximum() << "," << endl;
+	os << "  \"elapsed_time\": " << getElapsedTime() << "," << endl;
+	os << "  \"average_line_length\": " << getAverageLineLength() << "," << endl;
+	os << "  \"max_line_length\": " << getMaxLineLength() << "," << endl;
+	os << "  \"teller_utilization\": " << getUtilization() << "," << endl;
+	os << "  \"classes\": [";
+	for (int i = 0; i < CUSTOMER_CLASS_COUNT; i++) {
+		if (getClassCustomers(i) == 0)
+			continue;
+
+		os << (firstClass ? "" : ",") << endl;
+		os << "    { \"class\": " << i << ", \"customers\": " << getClassCustomers(i)
+			<< ", \"total_wait\": " << classWaitTime[i]
+			<< ", \"average_wait\": " << getClassAverageWait(i)
+			<< ", \"wait_p50\": " << getClassWaitAtPercentile(i, 50.0)
+			<< ", \"wait_p90\": " << getClassWaitAtPercentile(i, 90.0)
+			<< ", \"wait_p99\": " << getClassWaitAtPercentile(i, 99.0)
+			<< ", \"wait_max\": " << getClassMaxWait(i) << " }";
+		firstClass = false;
+	}
+	os << endl << "  ]," << endl;
+	os << "  \"wait_histogram\": ";
+	waits.writeJson(os);
+	os << endl << "}" << endl;
+
+	os.precision(precision);
+}
+
+
+// Description: Writes every accumulator to "checkpoint", so a run
+//				can be resumed with exactly these statistics.
+// Time Efficiency: O(histogram buckets * classes)
+void SimulationStatistics::writeCheckpoint(CheckpointWriter& checkpoint) const {
+
+	checkpoint.writeInt(tellerCount);
+	for (int i = 0; i < CUSTOMER_CLASS_COUNT; i++) {
+		classWaits[i].writeCheckpoint(checkpoint);
+		checkpoint.writeInt(classWaitTime[i]);
+	}
+
+	checkpoint.writeInt(customersServed);
+	checkpoint.writeInt(totalWaitTime);
+	checkpoint.writeInt(customersReneged);
+	checkpoint.writeInt(customersBalked);
+
+	checkpoint.writeInt(started);
+	checkpoint.writeInt(startTime);
+	checkpoint.writeInt(currentTime);
+	checkpoint.writeInt(waiting);
+	checkpoint.writeInt(busy);
+	checkpoint.writeInt(maxLineLength);
+	checkpoint.writeInt(waitingArea);
+	checkpoint.writeInt(busyArea);
+}
+
+
+// Description: Replaces every accumulator with those written by
+//				writeCheckpoint(), and returns "false" if they
+//				cannot be read or are for another number of tellers.
+// Time Efficiency: O(histogram buckets * classes)
+bool SimulationStatistics::readCheckpoint(CheckpointReader& checkpoint) {
+
+	if (checkpoint.readInt() != tellerCount) {
+		checkpoint.fail("checkpoint is for another number of tellers");
+		return false;
+	}
+
+	for (int i = 0; i < CUSTOMER_CLASS_COUNT; i++) {
+		classWaits[i].readCheckpoint(checkpoint);
+		classWaitTime[i] = checkpoint.readInt();
+	}
+
+	customersServed = checkpoint.readInt();
+	totalWaitTime = checkpoint.readInt();
+	customersReneged = checkpoint.readInt();
+	customersBalked = checkpoint.readInt();
+
+	started = checkpoint.readInt() != 0;
+	startTime = checkpoint.readInt();
+	currentTime = checkpoint.readInt();
+	waiting = checkpoint.readInt();
+	busy = checkpoint.readInt();
+	maxLineLength = checkpoint.readInt();
+	waitingArea = checkpoint.readInt();
+	busyArea = checkpoint.readInt();
+
+	return !checkpoint.hasFailed();
+}
+
+
+// Description: Returns the waiting times of every class together.
+// Time Efficiency: O(histogram buckets * classes)
+WaitHistogram SimulationStatistics::allWaits() const {
+
+	WaitHistogram waits;
+
+	for (int i = 0; i < CUSTOMER_CLASS_COUNT; i++) {
+		if (classWaits[i].getCount() > 0)
+			waits.add(classWaits[i]);
+	}
+
+	return waits;
+}
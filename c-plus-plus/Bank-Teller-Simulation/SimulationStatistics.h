@@ -0,0 +1,203 @@
+/*
+* SimulationStatistics.h
+*
+* Class Description: Statistics of one run of the bank simulation, kept as
+*					 the run goes in fixed memory and O(1) time per event:
+*					 the distribution of waiting times, in a WaitHistogram
+*					 for each customer class, merged when all customers'
+*					 waits are asked for,
+*					 and the time-weighted average number of customers in
+*					 line, the longest any line grew and the fraction of
+*					 time the tellers were busy, and how many customers
+*					 reneged or balked. Waiting times are those of the
+*					 customers served; a customer who reneges is counted
+*					 in line until they leave, but not in the waits.
+*					 Totals are long long, so they do not overflow on long
+*					 runs. Time-weighted averages are taken from the first
+*					 event to the last.
+*					 The statistics are kept as an observer of the
+*					 simulation (see SimulationObserver.h), updated by the
+*					 same hooks as any other.
+* Class Invariant: totalWaitTime is the sum of classWaitTime, and
+*				   customersServed that of the class histograms' counts,
+*				   less the customers still being served.
+*				   waitingArea and busyArea are the integrals, up to
+*				   currentTime, of the number of customers in line and of
+*				   the number of busy tellers.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <iostream>
+#include "Event.h"
+#include "WaitHistogram.h"
+
+using namespace std;
+
+class CheckpointWriter;
+class CheckpointReader;
+
+class SimulationStatistics {
+
+	private:
+		int tellerCount;			// Number of tellers
+		WaitHistogram classWaits[CUSTOMER_CLASS_COUNT];	// Waiting time of every customer served, by class
+		long long classWaitTime[CUSTOMER_CLASS_COUNT];	// Total time customers of each class waited
+		long long customersServed;	// Number of customers whose service has ended
+		long long totalWaitTime;	// Total time customers spent waiting in line
+		long long customersReneged;	// Customers who left the line unserved
+		long long customersBalked;	// Customers who would not join a line
+
+		bool started;				// Whether an event has been seen
+		int startTime;				// Time of the first event
+		int currentTime;			// Time of the latest event
+		int waiting;				// Number of customers in line, over all lines
+		int busy;					// Number of busy tellers
+		int maxLineLength;			// Most customers any one line has held
+		long long waitingArea;		// Customers in line, integrated over time
+		long long busyArea;			// Busy tellers, integrated over time
+
+		// Description: Returns the waiting times of every class together.
+		// Time Efficiency: O(histogram buckets * classes)
+		WaitHistogram allWaits() const;
+
+	public:
+		// Constructor
+		SimulationStatistics(int tellers = 1);
+
+		// Description: Clears the statistics for a new run with "tellers" tellers.
+		// Time Efficiency: O(histogram buckets)
+		void reset(int tellers);
+
+		// Description: Moves the clock to the time of the event being processed.
+		// Precondition: time is no earlier than the previous event's.
+		// Time Efficiency: O(1)
+		void advanceTo(int time);
+
+		// Description: Records an arrival; the statistics need nothing from
+		//				it, and it is defined here so that it compiles away.
+		// Time Efficiency: O(1)
+		void customerArrived(const Event& customer) {}
+
+		// Description: Records a customer leaving without joining a line.
+		// Time Efficiency: O(1)
+		void customerBalked(const Event& customer);
+
+		// Description: Records a customer joining or leaving "line", which
+		//				held "previousLength" customers and now holds "length".
+		// Time Efficiency: O(1)
+		void lineLengthChanged(int line, int previousLength, int length);
+
+		// Description: Records a customer leaving a line unserved.
+		// Time Efficiency: O(1)
+		void customerReneged(const Event& customer);
+
+		// Description: Records "teller" starting to serve "customer" at "time",
+		//				after they waited in line since their arrival.
+		// Time Efficiency: O(1)
+		void serviceStarted(const Event& customer, int teller, int time);
+
+		// Description: Records a teller finishing with a customer.
+		// Time Efficiency: O(1)
+		void customerDeparted(const Event& departure);
+
+		// Description: Returns the number of customers whose service has ended.
+		// Time Efficiency: O(1)
+		long long getCustomersServed() const;
+
+		// Description: Returns the total time customers spent waiting in line.
+		// Time Efficiency: O(1)
+		long long getTotalWaitTime() const;
+
+		// Description: Returns the number of customers who left a line unserved.
+		// Time Efficiency: O(1)
+		long long getCustomersReneged() const;
+
+		// Description: Returns the number of customers who would not join a line.
+		// Time Efficiency: O(1)
+		long long getCustomersBalked() const;
+
+		// Description: Returns the average time customers spent waiting in line.
+		// Time Efficiency: O(1)
+		float getAverageWait() const;
+
+		// Description: Returns the waiting time that "percentile" percent of
+		//				customers waited no longer than, within 1/64.
+		// Precondition: percentile is between 0 and 100.
+		// Time Efficiency: O(histogram buckets * classes)
+		int getWaitAtPercentile(double percentile) const;
+
+		// Description: Returns the longest time a customer waited in line.
+		// Time Efficiency: O(classes)
+		int getMaxWait() const;
+
+		// Description: Returns the number of customers of class
+		//				"customerClass" whose service has started.
+		// Time Efficiency: O(1)
+		long long getClassCustomers(int customerClass) const;
+
+		// Description: Returns the average time customers of class
+		//				"customerClass" spent waiting in line.
+		// Time Efficiency: O(1)
+		double getClassAverageWait(int customerClass) const;
+
+		// Description: Returns the waiting time that "percentile" percent of
+		//				customers of class "customerClass" waited no longer
+		//				than, within 1/64.
+		// Precondition: percentile is between 0 and 100.
+		// Time Efficiency: O(histogram buckets)
+		int getClassWaitAtPercentile(int customerClass, double percentile) const;
+
+		// Description: Returns the longest time a customer of class
+		//				"customerClass" waited in line.
+		// Time Efficiency: O(1)
+		int getClassMaxWait(int customerClass) const;
+
+		// Description: Returns the time from the first event to the last.
+		// Time Efficiency: O(1)
+		int getElapsedTime() const;
+
+		// Description: Returns the time-weighted average number of customers
+		//				in line, over all lines.
+		// Time Efficiency: O(1)
+		double getAverageLineLength() const;
+
+		// Description: Returns the most customers any one line has held.
+		// Time Efficiency: O(1)
+		int getMaxLineLength() const;
+
+		// Description: Returns the fraction of time the tellers were busy.
+		// Time Efficiency: O(1)
+		double getUtilization() const;
+
+		// Description: Writes the waiting time percentiles, line lengths and
+		//				utilization, one per tab-indented line, for the final
+		//				report.
+		// Time Efficiency: O(histogram buckets * classes)
+		void printReport(ostream& os) const;
+
+		// Description: Writes the number served, average wait and waiting
+		//				time percentiles of each class with customers, one
+		//				per tab-indented line.
+		// Time Efficiency: O(histogram buckets * classes)
+		void printClassReport(ostream& os) const;
+
+		// Description: Writes every statistic, those of each class with
+		//				customers, and the non-empty buckets of the waiting
+		//				time histogram, as a JSON object.
+		// Time Efficiency: O(histogram buckets * classes)
+		void writeJson(ostream& os) const;
+
+		// Description: Writes every accumulator to "checkpoint", so a run
+		//				can be resumed with exactly these statistics.
+		// Time Efficiency: O(histogram buckets * classes)
+		void writeCheckpoint(CheckpointWriter& checkpoint) const;
+
+		// Description: Replaces every accumulator with those written by
+		//				writeCheckpoint(), and returns "false" if they
+		//				cannot be read or are for another number of tellers.
+		// Time Efficiency: O(histogram buckets * classes)
+		bool readCheckpoint(CheckpointReader& checkpoint);
+
+}; // end SimulationStatistics
@@ -0,0 +1,184 @@
+/*
+* TraceBench.cpp
+*
+* Class Description: Benchmarks parsing of arrival traces: TraceReader,
+*					 which block-reads the file and parses integers by hand,
+*					 against cin >> on standard input, as SimulationApp used
+*					 to read its input. The trace is also converted to the
+*					 binary trace format, and BinaryTraceReader is timed
+*					 on that; its MB/s are of the text size it replaces.
+*					 Usage: traceBench [trace file]
+*					 Without a file, a trace of about 1 GB is generated in
+*					 traceBench.tmp, benchmarked and removed. The file is
+*					 read once before timing, so both readers see it in the
+*					 page cache and the figures measure parsing, not the disk.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include "Event.h"
+#include "TraceReader.h"
+#include "BinaryTraceReader.h"
+#include "BinaryTraceWriter.h"
+
+using namespace std;
+
+
+// Size of the generated trace
+const long long GENERATED_BYTES = 1LL << 30;
+
+// Arrivals parsed at a time by TraceReader
+const int BATCH_SIZE = 1024;
+
+
+// Description: Writes a trace of about "bytes" bytes of sorted arrivals to "path"
+void generateTrace(const string& path, long long bytes) {
+
+	FILE* trace = fopen(path.c_str(), "w");
+	mt19937 generator(225);
+	uniform_int_distribution<int> gap(0, 9);
+	uniform_int_distribution<int> length(1, 60);
+	long long written = 0;
+	int arrivalTime = 0;
+
+	while (written < bytes) {
+		arrivalTime += gap(generator);
+		written += fprintf(trace, "%d %d\n", arrivalTime, length(generator));
+	}
+
+	fclose(trace);
+}
+
+
+// Description: Returns the size of the file at "path" in bytes, reading it
+//				all so that it is in the page cache
+long long warmFile(const string& path) {
+
+	int trace = open(path.c_str(), O_RDONLY);
+	char block[1 << 16];
+	long long size = 0;
+	ssize_t count;
+
+	while ((count = read(trace, block, sizeof(block))) > 0)
+		size += count;
+
+	close(trace);
+	return size;
+}
+
+
+void printRow(const string& reader, long long arrivals, long long checksum, long long bytes, double seconds) {
+
+	cout << left << setw(14) << reader << right << setw(12) << arrivals << setw(22) << checksum
+		<< fixed << setprecision(2) << setw(10) << seconds << setprecision(1)
+		<< setw(10) << bytes / seconds / 1e6 << endl;
+}
+
+
+int main(int argc, char* argv[]) {
+
+	string path = (argc > 1) ? argv[1] : "traceBench.tmp";
+
+	if (argc <= 1)
+		generateTrace(path, GENERATED_BYTES);
+
+	long long bytes = warmFile(path);
+
+	cout << left << setw(14) << "Reader" << right << setw(12) << "Arrivals" << setw(22) << "Checksum"
+		<< setw(10) << "Seconds" << setw(10) << "MB/s" << endl;
+
+	// TraceReader, in batches as SimulationApp reads it
+	{
+		int trace = open(path.c_str(), O_RDONLY);
+		TraceReader reader(trace);
+		Event arrivals[BATCH_SIZE];
+		long long count = 0;
+		long long checksum = 0;
+		int batchCount;
+
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+		while ((batchCount = reader.readBatch(arrivals, BATCH_SIZE)) > 0) {
+			for (int i = 0; i < batchCount; i++)
+				checksum += arrivals[i].getTime() ^ arrivals[i].getLength();
+			count += batchCount;
+		}
+
+		chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+		printRow("TraceReader", count, checksum, bytes, elapsed.count());
+		close(trace);
+	}
+
+	// BinaryTraceReader, on the same arrivals converted to a binary trace
+	{
+		string binaryPath = path + ".btr";
+		int trace = open(path.c_str(), O_RDONLY);
+		int binary = open(binaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		TraceReader reader(trace);
+		Event arrival;
+
+		{
+			BinaryTraceWriter writer(binary, ARRIVAL_TRACE_COLUMNS, ARRIVAL_TRACE_COLUMN_COUNT);
+			while (reader.next(arrival)) {
+				int row[ARRIVAL_TRACE_COLUMN_COUNT] = { arrival.getTime(), arrival.getLength() };
+				writer.append(row);
+			}
+		}
+		close(binary);
+		close(trace);
+
+		long long binaryBytes = warmFile(binaryPath);
+		binary = open(binaryPath.c_str(), O_RDONLY);
+		BinaryTraceReader binaryReader(binary);
+		Event arrivals[BATCH_SIZE];
+		long long count = 0;
+		long long checksum = 0;
+		int batchCount;
+
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+		while ((batchCount = binaryReader.readBatch(arrivals, BATCH_SIZE)) > 0) {
+			for (int i = 0; i < batchCount; i++)
+				checksum += arrivals[i].getTime() ^ arrivals[i].getLength();
+			count += batchCount;
+		}
+
+		chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+		printRow("Binary trace", count, checksum, bytes, elapsed.count());
+		cout << "\t(binary trace is " << binaryBytes << " bytes)" << endl;
+		close(binary);
+		remove(binaryPath.c_str());
+	}
+
+	// cin >> on standard input, as SimulationApp used to read it
+	{
+		freopen(path.c_str(), "r", stdin);
+		int arrivalTime;
+		int transactionLength;
+		long long count = 0;
+		long long checksum = 0;
+
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+		while (cin >> arrivalTime >> transactionLength) {
+			checksum += arrivalTime ^ transactionLength;
+			count++;
+		}
+
+		chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+		printRow("cin >>", count, checksum, bytes, elapsed.count());
+	}
+
+	if (argc <= 1)
+		remove(path.c_str());
+
+	return 0;
+}
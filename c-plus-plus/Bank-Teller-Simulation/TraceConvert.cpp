@@ -0,0 +1,92 @@
+/*
+* TraceConvert.cpp
+*
+* Class Description: Converts traces between the text format of the .in
+*					 files and the binary trace format (BinaryTraceFormat.h).
+*					 Usage: traceConvert --to-binary < trace.in > trace.btr
+*							traceConvert --to-text < trace.btr > trace.in
+*					 A binary arrival trace converts back to the same pairs
+*					 as its text; other binary traces, such as the customer
+*					 logs written by sApp --log, become one line per row with
+*					 the columns separated by spaces.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include "Event.h"
+#include "TraceReader.h"
+#include "BinaryTraceReader.h"
+#include "BinaryTraceWriter.h"
+
+using namespace std;
+
+
+// Rows converted at a time
+const int CONVERT_BATCH_SIZE = 4096;
+
+
+// Description: Converts the text trace on standard input to a binary arrival
+//				trace on standard output, and returns the exit status
+int convertToBinary() {
+
+	TraceReader trace;
+	BinaryTraceWriter writer(1, ARRIVAL_TRACE_COLUMNS, ARRIVAL_TRACE_COLUMN_COUNT);
+	Event arrival;
+
+	while (trace.next(arrival)) {
+		int row[ARRIVAL_TRACE_COLUMN_COUNT] = { arrival.getTime(), arrival.getLength() };
+		writer.append(row);
+	}
+
+	if (!writer.finish()) {
+		cerr << "Cannot write binary trace" << endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+
+// Description: Converts the binary trace on standard input to text on
+//				standard output, and returns the exit status
+int convertToText() {
+
+	BinaryTraceReader trace;
+	int columnCount = trace.getColumnCount();
+	vector<int> rows(CONVERT_BATCH_SIZE * (columnCount > 0 ? columnCount : 1));
+	int count;
+
+	while ((count = trace.readRows(&rows[0], CONVERT_BATCH_SIZE)) > 0) {
+		for (int row = 0; row < count; row++) {
+			for (int i = 0; i < columnCount; i++)
+				printf(i + 1 < columnCount ? "%d " : "%d\n", rows[row * columnCount + i]);
+		}
+	}
+
+	fflush(stdout);
+
+	if (trace.hasFailed()) {
+		cerr << "Cannot read binary trace: " << trace.getError() << endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+
+int main(int argc, char* argv[]) {
+
+	string direction = (argc == 2) ? argv[1] : "";
+
+	if (direction == "--to-binary")
+		return convertToBinary();
+	else if (direction == "--to-text")
+		return convertToText();
+
+	cerr << "Usage: traceConvert --to-binary|--to-text < input > output" << endl;
+	return 1;
+}
@@ -0,0 +1,154 @@
+/*
+* TraceReader.cpp
+*
+* Class Description: Reads customer arrivals from a trace of
+*					 "arrival_time transaction_time" pairs in large blocks,
+*					 parsing integers by hand.
+* Class Invariant: Bytes from "position" to "end" of the buffer have been
+*				   read from the file but not yet parsed.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <unistd.h>
+#include "TraceReader.h"
+
+using namespace std;
+
+
+// Constructor; reads standard input by default
+TraceReader::TraceReader(int traceFileDescriptor) {
+	fileDescriptor = traceFileDescriptor;
+	buffer = new char[BUFFER_SIZE];
+	position = 0;
+	end = 0;
+	endOfFile = false;
+	stopped = false;
+	bytesRead = 0;
+	batchCount = 0;
+	batchPosition = 0;
+}
+
+
+// Destructor; the file descriptor is not closed
+TraceReader::~TraceReader() {
+	delete [] buffer;
+}
+
+
+// Description: Parses up to "capacity" arrivals into "arrivals" and
+//				returns how many were parsed, or 0 at the end of the trace.
+// Time Efficiency: O(bytes parsed)
+int TraceReader::readBatch(Event* arrivals, int capacity) {
+
+	int count = 0;
+	int arrivalTime;
+	int transactionLength;
+
+	while (count < capacity && !stopped) {
+		if (parseInteger(arrivalTime) && parseInteger(transactionLength))
+			arrivals[count++] = Event(ARRIVAL, arrivalTime, transactionLength);
+		else
+			stopped = true;
+	}
+
+	return count;
+}
+
+
+// Description: Reads the next arrival into "arrival" and returns "true",
+//				or returns "false" at the end of the trace.
+// Time Efficiency: O(1) amortized
+bool TraceReader::next(Event& arrival) {
+
+	if (batchPosition == batchCount) {
+		batchCount = readBatch(batch, BATCH_SIZE);
+		batchPosition = 0;
+
+		if (batchCount == 0)
+			return false;
+	}
+
+	arrival = batch[batchPosition++];
+	return true;
+}
+
+
+// Description: Returns the number of bytes read from the file so far.
+// Time Efficiency: O(1)
+long long TraceReader::getBytesRead() const {
+	return bytesRead;
+}
+
+
+// Description: Moves the unparsed bytes to the front of the buffer and
+//				fills the rest from the file.
+// Time Efficiency: O(BUFFER_SIZE)
+void TraceReader::refill() {
+
+	memmove(buffer, buffer + position, end - position);
+	end -= position;
+	position = 0;
+
+	while (end < BUFFER_SIZE && !endOfFile) {
+		ssize_t count = read(fileDescriptor, buffer + end, BUFFER_SIZE - end);
+
+		if (count > 0) {
+			end += count;
+			bytesRead += count;
+		}
+		else if (count == 0 || errno != EINTR)
+			endOfFile = true;
+	}
+}
+
+
+// Description: Parses the next integer into "value" and returns "true",
+//				or returns "false" if there is none.
+// Time Efficiency: O(digits), plus a refill now and then
+bool TraceReader::parseInteger(int& value) {
+
+	// Skip whitespace, refilling the buffer as it runs out
+	for (;;) {
+		while (position < end && (buffer[position] == ' ' || (buffer[position] >= '\t' && buffer[position] <= '\r')))
+			position++;
+
+		if (position < end || endOfFile)
+			break;
+		refill();
+	}
+
+	// Keep enough bytes in the buffer that a number is never split by its end
+	if (end - position < LOOKAHEAD && !endOfFile)
+		refill();
+
+	if (position == end)
+		return false;
+
+	bool negative = false;
+	if (buffer[position] == '-' || buffer[position] == '+') {
+		negative = (buffer[position] == '-');
+		position++;
+	}
+
+	// A number must have at least one digit and fit in an int, as with cin >>
+	size_t firstDigit = position;
+	long long magnitude = 0;
+
+	while (position < end && (unsigned)(buffer[position] - '0') < 10) {
+		magnitude = magnitude * 10 + (buffer[position] - '0');
+		position++;
+
+		if (magnitude > (long long)INT_MAX + 1)
+			return false;
+	}
+
+	if (position == firstDigit || (!negative && magnitude > INT_MAX))
+		return false;
+
+	value = negative ? (int)-magnitude : (int)magnitude;
+	return true;
+}
@@ -0,0 +1,81 @@
+/*
+* TraceReader.h
+*
+* Class Description: Reads customer arrivals from a trace of
+*					 "arrival_time transaction_time" pairs, as in the .in
+*					 files, much faster than reading them with cin >>.
+*					 The trace is read from a file descriptor in large blocks
+*					 with read(), and integers are parsed by hand from the
+*					 block, with no locale, stream state or stdio
+*					 synchronization. Arrivals are delivered in batches by
+*					 readBatch(), or one at a time by next() for
+*					 BankSimulation::runSorted().
+*					 As with cin >>, reading stops at the end of the input
+*					 or at the first token that is not an integer.
+* Class Invariant: Bytes from "position" to "end" of the buffer have been
+*				   read from the file but not yet parsed.
+* Created on: October 18, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <cstddef>
+#include "Event.h"
+
+using namespace std;
+
+class TraceReader {
+
+	private:
+		static const size_t BUFFER_SIZE = 1 << 20;	// Bytes read from the file at a time
+		static const size_t LOOKAHEAD = 64;			// Bytes kept in the buffer while parsing a number
+		static const int BATCH_SIZE = 4096;			// Arrivals parsed at a time by next()
+
+		int fileDescriptor;			// File the trace is read from
+		char* buffer;				// Block of the file being parsed
+		size_t position;			// Index of the next byte to parse
+		size_t end;					// Index one past the last byte read
+		bool endOfFile;				// Whether read() has reached the end of the file
+		bool stopped;				// Whether parsing has reached the end of the arrivals
+		long long bytesRead;		// Total bytes read from the file
+
+		Event batch[BATCH_SIZE];	// Arrivals parsed but not yet returned by next()
+		int batchCount;				// Number of arrivals in batch
+		int batchPosition;			// Index of the next arrival in batch to return
+
+		// Readers own their buffer; they are not copied
+		TraceReader(const TraceReader& aReader);
+		TraceReader& operator=(const TraceReader& aReader);
+
+		// Description: Moves the unparsed bytes to the front of the buffer and
+		//				fills the rest from the file.
+		// Time Efficiency: O(BUFFER_SIZE)
+		void refill();
+
+		// Description: Parses the next integer into "value" and returns "true",
+		//				or returns "false" if there is none.
+		// Time Efficiency: O(digits), plus a refill now and then
+		bool parseInteger(int& value);
+
+	public:
+		// Constructor; reads standard input by default
+		TraceReader(int traceFileDescriptor = 0);
+
+		// Destructor; the file descriptor is not closed
+		~TraceReader();
+
+		// Description: Parses up to "capacity" arrivals into "arrivals" and
+		//				returns how many were parsed, or 0 at the end of the trace.
+		// Time Efficiency: O(bytes parsed)
+		int readBatch(Event* arrivals, int capacity);
+
+		// Description: Reads the next arrival into "arrival" and returns "true",
+		//				or returns "false" at the end of the trace.
+		// Time Efficiency: O(1) amortized
+		bool next(Event& arrival);
+
+		// Description: Returns the number of bytes read from the file so far.
+		// Time Efficiency: O(1)
+		long long getBytesRead() const;
+
+}; // end TraceReader
@@ -0,0 +1,227 @@
+/*
+* WaitHistogram.cpp
+*
+* Class Description: A fixed-size histogram of non-negative int values,
+*					 in the style of an HDR histogram.
+* Class Invariant: count is the sum of the bucket counts.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <cmath>
+#include "WaitHistogram.h"
+#include "CheckpointWriter.h"
+#include "CheckpointReader.h"
+
+using namespace std;
+
+
+// Default constructor
+WaitHistogram::WaitHistogram() {
+	clear();
+}
+
+
+// Description: Removes every value.
+// Time Efficiency: O(buckets)
+void WaitHistogram::clear() {
+
+	for (int i = 0; i < BUCKET_COUNT; i++)
+		buckets[i] = 0;
+
+	count = 0;
+	maximum = 0;
+}
+
+
+// Description: Records "value".
+// Precondition: value is not negative.
+// Time Efficiency: O(1)
+void WaitHistogram::record(int value) {
+
+	buckets[bucketFor(value)]++;
+	count++;
+
+	if (value > maximum)
+		maximum = value;
+}
+
+
+// Description: Records every value recorded in "other".
+// Time Efficiency: O(buckets)
+void WaitHistogram::add(const WaitHistogram& other) {
+
+	for (int i = 0; i < BUCKET_COUNT; i++)
+		buckets[i] += other.buckets[i];
+
+	count += other.count;
+	if (other.maximum > maximum)
+		maximum = other.maximum;
+}
+
+
+// Description: Returns the number of values recorded.
+// Time Efficiency: O(1)
+long long WaitHistogram::getCount() const {
+	return count;
+}
+
+
+// Description: Returns the largest value recorded, or 0 if none.
+// Time Efficiency: O(1)
+int WaitHistogram::getMaximum() const {
+	return maximum;
+}
+
+
+// Description: Returns a value that "percentile" percent of the values
+//				are no greater than, to within the bucket precision, or 0
+//				if no values were recorded.
+// Precondition: percentile is between 0 and 100.
+// Time Efficiency: O(buckets)
+int WaitHistogram::getValueAtPercentile(double percentile) const {
+
+	if (count == 0)
+		return 0;
+
+	// The value of rank ceil(percentile% of count), counting from 1
+	long long rank = (long long)ceil(percentile / 100.0 * count);
+	if (rank < 1)
+		rank = 1;
+
+	long long seen = 0;
+	for (int i = 0; i < BUCKET_COUNT; i++) {
+		seen += buckets[i];
+
+		// Report the bucket's highest value, but never more than was recorded
+		if (seen >= rank)
+			return (highestValueOf(i) < maximum) ? highestValueOf(i) : maximum;
+	}
+
+	return maximum;
+}
+
+
+// Description: Writes the non-empty buckets as a JSON array of
+//				[lowest value, highest value, count] triples.
+// Time Efficiency: O(buckets)
+void WaitHistogram::writeJson(ostream& os) const {
+
+	bool first = true;
+
+	os << "[";
+	for (int i = 0; i < BUCKET_COUNT; i++) {
+		if (buckets[i] == 0)
+			continue;
+
+		os << (first ? "" : ", ") << "[" << lowestValueOf(i) << ", " << highestValueOf(i)
+			<< ", " << buckets[i] << "]";
+		first = false;
+	}
+	os << "]";
+}
+
+
+// Description: Writes the count, maximum and non-empty buckets to
+//				"checkpoint".
+// Time Efficiency: O(buckets)
+void WaitHistogram::writeCheckpoint(CheckpointWriter& checkpoint) const {
+
+	int nonEmpty = 0;
+	int previous = -1;
+
+	for (int i = 0; i < BUCKET_COUNT; i++) {
+		if (buckets[i] != 0)
+			nonEmpty++;
+	}
+
+	checkpoint.writeInt(count);
+	checkpoint.writeInt(maximum);
+	checkpoint.writeInt(nonEmpty);
+
+	// Each bucket as the gap from the one before it and its count
+	for (int i = 0; i < BUCKET_COUNT; i++) {
+		if (buckets[i] == 0)
+			continue;
+
+		checkpoint.writeInt(i - previous);
+		checkpoint.writeInt(buckets[i]);
+		previous = i;
+	}
+}
+
+
+// Description: Replaces the values with those written by
+//				writeCheckpoint(), and returns "false" if they
+//				cannot be read.
+// Time Efficiency: O(buckets)
+bool WaitHistogram::readCheckpoint(CheckpointReader& checkpoint) {
+
+	clear();
+
+	count = checkpoint.readInt();
+	maximum = checkpoint.readInt();
+
+	int nonEmpty = checkpoint.readCount(BUCKET_COUNT);
+	int index = -1;
+	long long total = 0;
+
+	for (int i = 0; i < nonEmpty; i++) {
+		index += checkpoint.readInt();
+		if (index < 0 || index >= BUCKET_COUNT) {
+			checkpoint.fail("checkpoint has a histogram bucket out of range");
+			break;
+		}
+
+		buckets[index] = checkpoint.readInt();
+		total += buckets[index];
+	}
+
+	if (!checkpoint.hasFailed() && total != count)
+		checkpoint.fail("checkpoint has a histogram whose buckets do not add up");
+
+	return !checkpoint.hasFailed();
+}
+
+
+// Description: Returns the bucket holding "value".
+// Time Efficiency: O(1)
+int WaitHistogram::bucketFor(int value) {
+
+	if (value < EXACT_VALUES)
+		return value;
+
+	// Keep the 7 highest bits: the leading 1 picks the power of two, and
+	// the 6 bits after it pick one of SUB_BUCKETS buckets within it
+	int highestBit = 31 - __builtin_clz((unsigned int)value);
+	int shift = highestBit - 6;
+
+	return EXACT_VALUES + (highestBit - 7) * SUB_BUCKETS + ((value >> shift) - SUB_BUCKETS);
+}
+
+
+// Description: Returns the smallest value held by bucket "index".
+// Time Efficiency: O(1)
+int WaitHistogram::lowestValueOf(int index) {
+
+	if (index < EXACT_VALUES)
+		return index;
+
+	int highestBit = (index - EXACT_VALUES) / SUB_BUCKETS + 7;
+	int subBucket = (index - EXACT_VALUES) % SUB_BUCKETS + SUB_BUCKETS;
+
+	return subBucket << (highestBit - 6);
+}
+
+
+// Description: Returns the largest value held by bucket "index".
+// Time Efficiency: O(1)
+int WaitHistogram::highestValueOf(int index) {
+
+	if (index < EXACT_VALUES)
+		return index;
+
+	int highestBit = (index - EXACT_VALUES) / SUB_BUCKETS + 7;
+
+	return lowestValueOf(index) + ((1 << (highestBit - 6)) - 1);
+}
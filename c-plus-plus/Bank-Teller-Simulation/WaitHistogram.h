@@ -0,0 +1,96 @@
+/*
+* WaitHistogram.h
+*
+* Class Description: A fixed-size histogram of non-negative int values,
+*					 such as customer waiting times, in the style of an HDR
+*					 histogram. Values below 128 are counted exactly; larger
+*					 values share a bucket with others that agree in their
+*					 7 highest bits, so every value is within 1/64 (about
+*					 1.6%) of its bucket's bounds. The 1664 buckets cover
+*					 every int, so memory never grows with the number or
+*					 size of the values.
+* Class Invariant: count is the sum of the bucket counts.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <iostream>
+
+using namespace std;
+
+class CheckpointWriter;
+class CheckpointReader;
+
+class WaitHistogram {
+
+	private:
+		static const int EXACT_VALUES = 128;			// Values below this are counted exactly
+		static const int SUB_BUCKETS = 64;				// Buckets per power of two above that
+		static const int BUCKET_COUNT = EXACT_VALUES + 24 * SUB_BUCKETS;
+
+		long long buckets[BUCKET_COUNT];	// Number of values recorded in each bucket
+		long long count;					// Number of values recorded
+		int maximum;						// Largest value recorded
+
+		// Description: Returns the bucket holding "value".
+		// Time Efficiency: O(1)
+		static int bucketFor(int value);
+
+		// Description: Returns the smallest value held by bucket "index".
+		// Time Efficiency: O(1)
+		static int lowestValueOf(int index);
+
+		// Description: Returns the largest value held by bucket "index".
+		// Time Efficiency: O(1)
+		static int highestValueOf(int index);
+
+	public:
+		// Default constructor
+		WaitHistogram();
+
+		// Description: Removes every value.
+		// Time Efficiency: O(buckets)
+		void clear();
+
+		// Description: Records "value".
+		// Precondition: value is not negative.
+		// Time Efficiency: O(1)
+		void record(int value);
+
+		// Description: Records every value recorded in "other".
+		// Time Efficiency: O(buckets)
+		void add(const WaitHistogram& other);
+
+		// Description: Returns the number of values recorded.
+		// Time Efficiency: O(1)
+		long long getCount() const;
+
+		// Description: Returns the largest value recorded, or 0 if none.
+		// Time Efficiency: O(1)
+		int getMaximum() const;
+
+		// Description: Returns a value that "percentile" percent of the values
+		//				are no greater than, to within the bucket precision, or 0
+		//				if no values were recorded.
+		// Precondition: percentile is between 0 and 100.
+		// Time Efficiency: O(buckets)
+		int getValueAtPercentile(double percentile) const;
+
+		// Description: Writes the non-empty buckets as a JSON array of
+		//				[lowest value, highest value, count] triples.
+		// Time Efficiency: O(buckets)
+		void writeJson(ostream& os) const;
+
+		// Description: Writes the count, maximum and non-empty buckets to
+		//				"checkpoint".
+		// Time Efficiency: O(buckets)
+		void writeCheckpoint(CheckpointWriter& checkpoint) const;
+
+		// Description: Replaces the values with those written by
+		//				writeCheckpoint(), and returns "false" if they
+		//				cannot be read.
+		// Time Efficiency: O(buckets)
+		bool readCheckpoint(CheckpointReader& checkpoint);
+
+}; // end WaitHistogram
@@ -0,0 +1,128 @@
+/*
+* WorkStealingPool.cpp
+*
+* Class Description: Runs a batch of independent tasks on a fixed number of
+*					 threads, each with its own deque of tasks, stealing from
+*					 the others when it runs out.
+* Class Invariant: Between calls to run(), every deque is empty. threadCount
+*				   is at least 1.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#include <thread>
+#include "WorkStealingPool.h"
+
+using namespace std;
+
+
+// Description: Returns "threads", or the number of cores if threads is 0
+//				or less, and at least 1.
+static int chooseThreadCount(int threads) {
+
+	if (threads <= 0)
+		threads = thread::hardware_concurrency();
+	if (threads <= 0)
+		threads = 1;
+
+	return threads;
+}
+
+
+// Constructor
+// Description: Makes a pool of "threads" workers, or one per core if
+//				threads is 0 or less.
+WorkStealingPool::WorkStealingPool(int threads)
+	: threadCount(chooseThreadCount(threads)), deques(threadCount) {
+}
+
+
+// Description: Returns the number of workers, the caller included.
+// Time Efficiency: O(1)
+int WorkStealingPool::getThreadCount() const {
+	return threadCount;
+}
+
+
+// Description: Calls runTask(worker, task) once for each task from 0
+//				to taskCount - 1, in parallel, and returns when all
+//				have finished. "worker" is between 0 and
+//				getThreadCount() - 1, and no two calls with the same
+//				worker run at once, so it can index per-thread state.
+// Precondition: Tasks do not depend on each other's order.
+// Time Efficiency: O(taskCount) plus the tasks, spread over the workers
+void WorkStealingPool::run(int taskCount, const function<void(int, int)>& runTask) {
+
+	vector<thread> workers;
+	int threads = (threadCount < taskCount) ? threadCount : taskCount;
+
+	// Deal the tasks out in contiguous blocks, in order, before any
+	// worker starts, so each begins with its share
+	for (int worker = 0; worker < threads; worker++) {
+		int first = (long long)taskCount * worker / threads;
+		int last = (long long)taskCount * (worker + 1) / threads;
+
+		for (int task = last - 1; task >= first; task--)
+			deques[worker].tasks.push_back(task);
+	}
+
+	// The calling thread is one of the workers
+	for (int worker = 1; worker < threads; worker++)
+		workers.push_back(thread(&WorkStealingPool::work, this, worker, cref(runTask)));
+	if (threads > 0)
+		work(0, runTask);
+
+	for (size_t i = 0; i < workers.size(); i++)
+		workers[i].join();
+}
+
+
+// Description: Runs tasks as "worker" until none are left anywhere.
+// Time Efficiency: The tasks it runs, plus O(threads) per steal
+void WorkStealingPool::work(int worker, const function<void(int, int)>& runTask) {
+
+	int task;
+
+	// No task makes new ones, so once every deque is empty the batch is done
+	while (takeOwn(worker, task) || steal(worker, task))
+		runTask(worker, task);
+}
+
+
+// Description: Takes the last task from the deque of "worker" into
+//				"task", and returns "false" if there is none.
+// Time Efficiency: O(1)
+bool WorkStealingPool::takeOwn(int worker, int& task) {
+
+	lock_guard<mutex> guard(deques[worker].lock);
+	deque<int>& tasks = deques[worker].tasks;
+
+	if (tasks.empty())
+		return false;
+
+	task = tasks.back();
+	tasks.pop_back();
+	return true;
+}
+
+
+// Description: Takes the first task from another worker's deque into
+//				"task", trying each in turn after "thief", and returns
+//				"false" if every deque is empty.
+// Time Efficiency: O(threads)
+bool WorkStealingPool::steal(int thief, int& task) {
+
+	for (int i = 1; i < threadCount; i++) {
+		TaskDeque& victim = deques[(thief + i) % threadCount];
+		lock_guard<mutex> guard(victim.lock);
+
+		// The front holds the victim's last tasks, which it would reach last
+		if (!victim.tasks.empty()) {
+			task = victim.tasks.front();
+			victim.tasks.pop_front();
+			return true;
+		}
+	}
+
+	return false;
+}
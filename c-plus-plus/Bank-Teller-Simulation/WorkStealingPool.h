@@ -0,0 +1,72 @@
+/*
+* WorkStealingPool.h
+*
+* Class Description: Runs a batch of independent tasks, numbered 0 to n - 1,
+*					 on a fixed number of threads. Each thread starts with
+*					 its own contiguous block of tasks in a deque and takes
+*					 them from the back; a thread that runs out steals from
+*					 the front of another thread's deque, so long tasks on
+*					 one thread do not leave the others idle, and threads
+*					 rarely contend for the same lock. The calling thread
+*					 is worker 0.
+* Class Invariant: Between calls to run(), every deque is empty. threadCount
+*				   is at least 1.
+* Created on: October 19, 2026
+* Author: Andrew Adams
+*/
+
+#pragma once
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+class WorkStealingPool {
+
+	private:
+		// The tasks waiting for one worker, and the lock guarding them
+		struct TaskDeque {
+			mutex lock;
+			deque<int> tasks;
+		};
+
+		int threadCount;			// Number of worker threads, the caller included
+		vector<TaskDeque> deques;	// Each worker's tasks
+
+		// Description: Takes the last task from the deque of "worker" into
+		//				"task", and returns "false" if there is none.
+		// Time Efficiency: O(1)
+		bool takeOwn(int worker, int& task);
+
+		// Description: Takes the first task from another worker's deque into
+		//				"task", trying each in turn after "thief", and returns
+		//				"false" if every deque is empty.
+		// Time Efficiency: O(threads)
+		bool steal(int thief, int& task);
+
+		// Description: Runs tasks as "worker" until none are left anywhere.
+		// Time Efficiency: The tasks it runs, plus O(threads) per steal
+		void work(int worker, const function<void(int, int)>& runTask);
+
+	public:
+		// Constructor
+		// Description: Makes a pool of "threads" workers, or one per core if
+		//				threads is 0 or less.
+		WorkStealingPool(int threads = 0);
+
+		// Description: Returns the number of workers, the caller included.
+		// Time Efficiency: O(1)
+		int getThreadCount() const;
+
+		// Description: Calls runTask(worker, task) once for each task from 0
+		//				to taskCount - 1, in parallel, and returns when all
+		//				have finished. "worker" is between 0 and
+		//				getThreadCount() - 1, and no two calls with the same
+		//				worker run at once, so it can index per-thread state.
+		// Precondition: Tasks do not depend on each other's order.
+		// Time Efficiency: O(taskCount) plus the tasks, spread over the workers
+		void run(int taskCount, const function<void(int, int)>& runTask);
+
+}; // end WorkStealingPool